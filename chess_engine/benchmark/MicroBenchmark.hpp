@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../src/defines.hpp"
+
+namespace owl
+{
+	namespace benchmark
+	{
+		constexpr INT64 MIN_SAMPLE_TIME_NS = 50000000; // Mindestdauer einer Messung in ns (50 ms)
+		constexpr INT32 SAMPLES = 5; // Anzahl der Messungen je Benchmark, gewertet wird die schnellste
+
+		/**
+		 * Ergebnis eines Mikro-Benchmarks.
+		 */
+		struct MicroBenchmarkResult
+		{
+			std::string name; // Name des Benchmarks
+			double nsPerOperation = 0.0; // Zeit je Operation in ns
+		};
+
+		/**
+		 * Einfacher Messrahmen fr einzelne Bausteine der Engine (Zuggenerierung, Bewertung, ...).
+		 * Jeder Benchmark wird mehrfach fr mindestens MIN_SAMPLE_TIME_NS ausgefhrt, die schnellste Messung wird in ns je Operation angegeben
+		 * und mit einer gespeicherten Basislinie (Textdatei: Name, Tabulator, ns/op) verglichen.
+		 */
+		class MicroBenchmark
+		{
+		public:
+			/**
+			 * Benchmark messen und ausgeben.
+			 *
+			 * \tparam Function Funktion ohne Parameter, gibt die Anzahl der ausgefhrten Operationen zurck
+			 * \param name Name des Benchmarks
+			 * \param function Zu messende Funktion
+			 */
+			template <typename Function>
+			VOID run(const std::string& name, Function function)
+			{
+				if (!m_filter.empty() && name.find(m_filter) == std::string::npos) return;
+
+				// Aufwrmen (Caches, Tabellen)
+				consume(function());
+
+				auto best = 0.0;
+				for (auto sample = 0; sample < SAMPLES; sample++)
+				{
+					INT64 operations = 0;
+					INT64 elapsed = 0;
+					auto start = std::chrono::steady_clock::now();
+
+					while (elapsed < MIN_SAMPLE_TIME_NS)
+					{
+						operations += function();
+						elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+					}
+
+					auto ns_per_operation = static_cast<double>(elapsed) / static_cast<double>(std::max<INT64>(operations, 1));
+					if (sample == 0 || ns_per_operation < best) best = ns_per_operation;
+				}
+
+				m_results.push_back({ name, best });
+				print(m_results.back());
+			}
+			/**
+			 * Wert verbrauchen, damit der Compiler die gemessene Berechnung nicht entfernt.
+			 *
+			 * \param value Ergebnis der Berechnung
+			 */
+			static VOID consume(INT64 value)
+			{
+				static volatile INT64 sink = 0;
+				sink = sink + value;
+			}
+			/**
+			 * Nur Benchmarks messen, deren Name den Text enthlt.
+			 *
+			 * \param filter Text (leer: alle Benchmarks)
+			 */
+			VOID setFilter(const std::string& filter)
+			{
+				m_filter = filter;
+			}
+			/**
+			 * Basislinie fr den Vergleich laden.
+			 *
+			 * \param path Dateipfad
+			 * \return Erfolgreich?
+			 */
+			BOOL loadBaseline(const std::string& path)
+			{
+				std::ifstream file(path);
+				if (!file) return false;
+
+				std::string line;
+				while (std::getline(file, line))
+				{
+					auto separator = line.rfind('\t');
+					if (separator == std::string::npos) continue;
+
+					// Fehlerhafte Zeilen berspringen
+					try
+					{
+						m_baseline[line.substr(0, separator)] = std::stod(line.substr(separator + 1));
+					}
+					catch (const std::exception&)
+					{
+					}
+				}
+
+				return true;
+			}
+			/**
+			 * Alle Ergebnisse als Basislinie speichern.
+			 *
+			 * \param path Dateipfad
+			 * \return Erfolgreich?
+			 */
+			BOOL saveBaseline(const std::string& path) const
+			{
+				std::ofstream file(path);
+				if (!file) return false;
+
+				for (const auto& result : m_results) file << result.name << '\t' << std::fixed << std::setprecision(2) << result.nsPerOperation << '\n';
+
+				return static_cast<BOOL>(file);
+			}
+		private:
+			/**
+			 * Ein Ergebnis ausgeben, mit Basislinie die relative nderung.
+			 *
+			 * \param result Ergebnis
+			 */
+			VOID print(const MicroBenchmarkResult& result) const
+			{
+				std::cout << std::left << std::setw(64) << result.name << std::right << std::fixed << std::setprecision(2)
+					<< std::setw(12) << result.nsPerOperation << " ns/op";
+
+				auto it = m_baseline.find(result.name);
+				if (it != m_baseline.end() && it->second > 0.0)
+				{
+					auto change = (result.nsPerOperation / it->second - 1.0) * 100.0;
+					std::cout << std::setw(12) << it->second << " ns/op" << std::showpos << std::setw(10) << change << " %" << std::noshowpos;
+				}
+
+				std::cout << std::endl;
+			}
+
+			std::vector<MicroBenchmarkResult> m_results; // Ergebnisse in Reihenfolge der Messung
+			std::unordered_map<std::string, double> m_baseline; // ns/op der Basislinie je Name
+			std::string m_filter; // Filter fr die Namen
+		};
+	}
+}
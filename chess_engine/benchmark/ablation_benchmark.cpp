@@ -0,0 +1,252 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../src/Benchmark.hpp"
+#include "../src/Bitbase.hpp"
+#include "../src/ChessEngine.hpp"
+#include "../src/ChessUtility.hpp"
+
+using namespace owl;
+
+namespace
+{
+	constexpr INT32 ABLATION_DEFAULT_DEPTH = 4; // Suchtiefe je Stellung
+
+	// Umgesetzte Such-Features (FT_HISTORY, FT_PVS und FT_NESTED sind nicht implementiert)
+	constexpr UCHAR SEARCH_FEATURES[] = { FT_ALPHA_BETA, FT_SRT_MATERIAL, FT_SRT_MVV_LVA, FT_SRT_KILLER };
+	constexpr UCHAR SEARCH_FEATURES_ALL = FT_ALPHA_BETA | FT_SRT_MATERIAL | FT_SRT_MVV_LVA | FT_SRT_KILLER;
+
+	// Features der Bewertungsfunktion
+	constexpr UCHAR EVALUATION_FEATURES[] = {
+		EVAL_FT_MATERIAL_DYNAMIC_GAME_PHASE, EVAL_FT_PIECE_SQUARE_TABLE, EVAL_FT_PIECE_MOBILITY,
+		EVAL_FT_PAWN_STRUCTURE, EVAL_FT_BISHOP_PAIR, EVAL_FT_DYNAMIC_PAWNS
+	};
+
+	/**
+	 * Kombination aus Such- und Bewertungs-Features.
+	 */
+	struct Configuration
+	{
+		UCHAR searchFlags = FT_STANDARD;			// FT_*
+		UCHAR evaluationFlags = EVAL_FT_STANDARD;	// EVAL_FT_*
+	};
+
+	/**
+	 * Messwerte einer Suche.
+	 */
+	struct Measurement
+	{
+		INT64 nodes = 0;		// Durchsuchte Knoten
+		INT64 prunes = 0;		// Abschneidungen
+		INT64 time = 0;			// Zeit bis zum Abschluss der Suchtiefe in ms
+		double branching = 0.0;	// Effektiver Verzweigungsfaktor: Knotenzuwachs der letzten durch den der vorletzten Iteration (0 bei weniger als drei Iterationen)
+		std::string bestMove;	// Gefundener Zug
+	};
+
+	/**
+	 * Stellungen aus einer EPD-Datei lesen. Die ersten vier Felder bilden die Stellung, Operationen (z.B. "bm") werden ignoriert.
+	 *
+	 * \param path Dateipfad
+	 * \return FEN-Strings
+	 */
+	std::vector<std::string> readEpd(const std::string& path)
+	{
+		std::vector<std::string> fens;
+		std::ifstream file(path);
+		std::string line;
+
+		while (std::getline(file, line))
+		{
+			std::istringstream fields(line);
+			std::string board, player, castling, en_passant;
+			if (!(fields >> board >> player >> castling >> en_passant)) continue;
+
+			fens.push_back(board + " " + player + " " + castling + " " + en_passant + " 0 1");
+		}
+
+		return fens;
+	}
+
+	/**
+	 * Alle Kombinationen der Flags erzeugen.
+	 *
+	 * \param features Einzelne Flags
+	 * \return Alle Teilmengen als Bitmaske
+	 */
+	template <size_t N>
+	std::vector<UCHAR> getCombinations(const UCHAR (&features)[N])
+	{
+		std::vector<UCHAR> combinations;
+		for (size_t mask = 0; mask < (1U << N); mask++)
+		{
+			UCHAR flags = 0;
+			for (size_t i = 0; i < N; i++) if (mask & (1U << i)) flags |= features[i];
+			combinations.push_back(flags);
+		}
+		return combinations;
+	}
+
+	/**
+	 * Eine Stellung mit einer Kombination durchsuchen. Jede Suche verwendet eine eigene Engine und leere Zwischenspeicher.
+	 *
+	 * \param fen Stellung
+	 * \param configuration Such- und Bewertungs-Features
+	 * \param depth Suchtiefe
+	 * \return Messwerte
+	 */
+	Measurement measure(const std::string& fen, const Configuration& configuration, INT32 depth)
+	{
+		ChessEngine engine;
+		engine.setEvaluationFeatures(configuration.evaluationFlags);
+		engine.getPosition() = ChessUtility::fenToPosition(fen);
+
+		// Knoten je abgeschlossener Iteration (kumuliert)
+		std::vector<INT64> iteration_nodes;
+		engine.setSearchInfoCallback([&iteration_nodes](const SearchInfo& info) {
+			if (info.type == SearchInfo::Type::Iteration && info.multiPv == 1) iteration_nodes.push_back(info.nodes);
+		});
+
+		engine.prepareSearch();
+		auto result = engine.searchMove(engine.getPosition().getPlayer(), depth, configuration.searchFlags);
+
+		Measurement measurement;
+		measurement.nodes = engine.getNodesCount();
+		measurement.prunes = engine.getPrunesCount();
+		measurement.time = engine.getSearchTime() / 1000;
+		measurement.bestMove = ChessUtility::moveToString(result.first);
+
+		if (iteration_nodes.size() >= 3)
+		{
+			auto last = iteration_nodes.end();
+			auto previous = static_cast<double>(*(last - 2) - *(last - 3));
+			if (previous > 0.0) measurement.branching = static_cast<double>(*(last - 1) - *(last - 2)) / previous;
+		}
+
+		return measurement;
+	}
+}
+
+/**
+ * Ablationsstudie ber Kombinationen der Such-Features (FT_*) und Bewertungs-Features (EVAL_FT_*).
+ * Ausgabe als CSV: je Kombination und Stellung eine Zeile, danach eine Zeile mit der Summe je Kombination (position "all").
+ *
+ * Aufruf: ablation_benchmark [--epd Datei] [--depth N] [--threads N] [--mode ablation|search|evaluation|full] [--out Datei]
+ *  - ablation:   Standard-Features sowie je ein Feature weniger (Standard)
+ *  - search:     Alle Kombinationen der Such-Features mit EVAL_FT_STANDARD
+ *  - evaluation: Alle Kombinationen der Bewertungs-Features mit FT_STANDARD
+ *  - full:       Kreuzprodukt aller Such- und Bewertungs-Features
+ */
+auto main(INT32 argc, CHAR* argv[]) -> INT32
+{
+	std::vector<std::string> fens(std::begin(BENCH_FENS), std::end(BENCH_FENS));
+	INT32 depth = ABLATION_DEFAULT_DEPTH;
+	INT32 threads = std::max(1U, std::thread::hardware_concurrency());
+	std::string mode = "ablation";
+	std::string out_path;
+
+	for (auto i = 1; i + 1 < argc; i += 2)
+	{
+		std::string option = argv[i];
+		std::string value = argv[i + 1];
+
+		if (option == "--epd") fens = readEpd(value);
+		else if (option == "--depth") depth = std::stoi(value);
+		else if (option == "--threads") threads = std::max(1, std::stoi(value));
+		else if (option == "--mode") mode = value;
+		else if (option == "--out") out_path = value;
+	}
+
+	if (fens.empty())
+	{
+		std::cerr << "no positions" << std::endl;
+		return 1;
+	}
+
+	std::vector<Configuration> configurations;
+	if (mode == "search" || mode == "full")
+	{
+		auto evaluation_flags = mode == "full" ? getCombinations(EVALUATION_FEATURES) : std::vector<UCHAR>{ EVAL_FT_STANDARD };
+		for (auto search_flags : getCombinations(SEARCH_FEATURES))
+		{
+			for (auto flags : evaluation_flags) configurations.push_back({ search_flags, flags });
+		}
+	}
+	else if (mode == "evaluation")
+	{
+		for (auto flags : getCombinations(EVALUATION_FEATURES)) configurations.push_back({ FT_STANDARD, flags });
+	}
+	else
+	{
+		configurations.push_back({ FT_STANDARD, EVAL_FT_STANDARD });
+		for (auto feature : SEARCH_FEATURES) configurations.push_back({ static_cast<UCHAR>(SEARCH_FEATURES_ALL & ~feature), EVAL_FT_STANDARD });
+		for (auto feature : EVALUATION_FEATURES) configurations.push_back({ FT_STANDARD, static_cast<UCHAR>(EVAL_FT_STANDARD & ~feature) });
+	}
+
+	// Bitbasen vor den Threads einblenden, die Engines verwenden sie gemeinsam
+	ChessValidation::init();
+	Bitbase::init(BITBASE_FILE);
+
+	// Alle Suchen (Kombination x Stellung) auf die Threads verteilen
+	auto tasks = configurations.size() * fens.size();
+	std::vector<Measurement> measurements(tasks);
+	std::atomic<size_t> next_task = 0;
+
+	auto worker = [&]() {
+		for (auto task = next_task++; task < tasks; task = next_task++)
+		{
+			measurements[task] = measure(fens[task % fens.size()], configurations[task / fens.size()], depth);
+		}
+	};
+
+	std::vector<std::thread> workers;
+	for (auto i = 0; i < threads; i++) workers.emplace_back(worker);
+	for (auto& thread : workers) thread.join();
+
+	std::ofstream out_file;
+	if (!out_path.empty()) out_file.open(out_path);
+	std::ostream& out = out_file.is_open() ? out_file : std::cout;
+
+	out << "search_flags,eval_flags,position,depth,nodes,prunes,time_ms,ebf,bestmove\n";
+
+	for (size_t c = 0; c < configurations.size(); c++)
+	{
+		const auto& configuration = configurations[c];
+		auto prefix = std::to_string(configuration.searchFlags) + "," + std::to_string(configuration.evaluationFlags) + ",";
+
+		Measurement total;
+		double log_branching = 0.0;
+		INT32 branching_count = 0;
+
+		for (size_t p = 0; p < fens.size(); p++)
+		{
+			const auto& measurement = measurements[c * fens.size() + p];
+			out << prefix << p + 1 << "," << depth << "," << measurement.nodes << "," << measurement.prunes << ","
+				<< measurement.time << "," << measurement.branching << "," << measurement.bestMove << "\n";
+
+			total.nodes += measurement.nodes;
+			total.prunes += measurement.prunes;
+			total.time += measurement.time;
+
+			if (measurement.branching > 0.0)
+			{
+				log_branching += std::log(measurement.branching);
+				branching_count++;
+			}
+		}
+
+		// Geometrisches Mittel der Verzweigungsfaktoren
+		total.branching = branching_count > 0 ? std::exp(log_branching / branching_count) : 0.0;
+
+		out << prefix << "all," << depth << "," << total.nodes << "," << total.prunes << "," << total.time << "," << total.branching << ",\n";
+	}
+
+	return 0;
+}
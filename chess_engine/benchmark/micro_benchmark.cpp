@@ -0,0 +1,112 @@
+#include "MicroBenchmark.hpp"
+
+#include "../src/Benchmark.hpp"
+#include "../src/Bitbase.hpp"
+#include "../src/ChessEvaluation.hpp"
+#include "../src/ChessUtility.hpp"
+#include "../src/ChessValidation.hpp"
+#include "../src/RepitionMap.hpp"
+
+using namespace owl;
+
+namespace
+{
+	// Bewertungsfunktion je Feature-Flag
+	const std::vector<PAIR<std::string, UCHAR>> EVALUATION_FEATURES = {
+		{ "EVAL_FT_NULL", EVAL_FT_NULL },
+		{ "EVAL_FT_MATERIAL_DYNAMIC_GAME_PHASE", EVAL_FT_MATERIAL_DYNAMIC_GAME_PHASE },
+		{ "EVAL_FT_PIECE_SQUARE_TABLE", EVAL_FT_PIECE_SQUARE_TABLE },
+		{ "EVAL_FT_PIECE_MOBILITY", EVAL_FT_PIECE_MOBILITY },
+		{ "EVAL_FT_PAWN_STRUCTURE", EVAL_FT_PAWN_STRUCTURE },
+		{ "EVAL_FT_BISHOP_PAIR", EVAL_FT_BISHOP_PAIR },
+		{ "EVAL_FT_DYNAMIC_PAWNS", EVAL_FT_DYNAMIC_PAWNS },
+		{ "EVAL_FT_STANDARD", EVAL_FT_STANDARD },
+	};
+}
+
+/**
+ * Mikro-Benchmarks ber die Stellungen aus BENCH_FENS.
+ * Aufruf: micro_benchmark [--filter Text] [--baseline Datei] [--save Datei]
+ */
+auto main(INT32 argc, CHAR* argv[]) -> INT32
+{
+	benchmark::MicroBenchmark bench;
+	std::string save_path;
+
+	for (auto i = 1; i + 1 < argc; i += 2)
+	{
+		std::string option = argv[i];
+		if (option == "--filter") bench.setFilter(argv[i + 1]);
+		else if (option == "--save") save_path = argv[i + 1];
+		else if (option == "--baseline" && !bench.loadBaseline(argv[i + 1])) std::cerr << "baseline " << argv[i + 1] << " not found" << std::endl;
+	}
+
+	ChessValidation::init();
+	Bitbase::init(BITBASE_FILE);
+
+	std::vector<Position> positions;
+	std::vector<MOVE_LIST> moves;
+	for (const auto* fen : BENCH_FENS)
+	{
+		positions.push_back(ChessUtility::fenToPosition(fen));
+		moves.push_back(ChessValidation::getValidMoves(positions.back(), positions.back().getPlayer()));
+	}
+
+	bench.run("Position::applyMove/undoLastMove", [&]() {
+		INT64 operations = 0;
+		for (size_t i = 0; i < positions.size(); i++)
+		{
+			for (const auto& move : moves[i])
+			{
+				positions[i].applyMove(move);
+				positions[i].undoLastMove();
+			}
+			operations += moves[i].size();
+		}
+		return operations;
+	});
+
+	bench.run("ChessValidation::getValidMoves", [&]() {
+		for (auto& position : positions) benchmark::MicroBenchmark::consume(ChessValidation::getValidMoves(position, position.getPlayer()).size());
+		return static_cast<INT64>(positions.size());
+	});
+
+	bench.run("ChessValidation::isKingInCheck", [&]() {
+		for (auto& position : positions) benchmark::MicroBenchmark::consume(ChessValidation::isKingInCheck(position, position.getPlayer()));
+		return static_cast<INT64>(positions.size());
+	});
+
+	// Ohne Zwischenspeicher und Bauern-Hash, sonst wrde nur der Treffer gemessen
+	ChessEvaluation::getEvaluationCache().setEnabled(false);
+	ChessEvaluation::getPawnHashTable().setEnabled(false);
+	for (const auto& [name, flags] : EVALUATION_FEATURES)
+	{
+		bench.run("ChessEvaluation::evaluate " + name, [&, flags = flags]() {
+			for (auto& position : positions) benchmark::MicroBenchmark::consume(ChessEvaluation::evaluate(position, position.getPlayer(), flags));
+			return static_cast<INT64>(positions.size());
+		});
+	}
+	ChessEvaluation::getEvaluationCache().setEnabled(true);
+	ChessEvaluation::getPawnHashTable().setEnabled(true);
+
+	// Kopien, da eine erkannte Wiederholung den Spielstatus setzt
+	auto repetition_positions = positions;
+	RepitionMap repition_map;
+	bench.run("RepitionMap::addPosition/isPositionAlreadyLocked", [&]() {
+		for (auto& position : repetition_positions)
+		{
+			repition_map.addPosition(position);
+			benchmark::MicroBenchmark::consume(repition_map.isPositionAlreadyLocked(position));
+		}
+		return static_cast<INT64>(repetition_positions.size());
+	});
+
+	bench.run("ChessUtility::fenToPosition", [&]() {
+		for (const auto* fen : BENCH_FENS) benchmark::MicroBenchmark::consume(ChessUtility::fenToPosition(fen).getKey());
+		return static_cast<INT64>(std::size(BENCH_FENS));
+	});
+
+	if (!save_path.empty() && !bench.saveBaseline(save_path)) std::cerr << "could not write baseline " << save_path << std::endl;
+
+	return 0;
+}
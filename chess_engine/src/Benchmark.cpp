@@ -0,0 +1,44 @@
+#include "Benchmark.hpp"
+#include "ChessEngine.hpp"
+#include "ChessUtility.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace owl
+{
+	INT64 BenchmarkResult::getNodesPerSecond() const
+	{
+		return nodes * 1000 / std::max<INT64>(time, 1);
+	}
+
+	BenchmarkResult Benchmark::run(INT32 depth, const BENCH_POSITION_CALLBACK& callback)
+	{
+		// Eigene Engine, damit Stellung, Optionen und Hauptvariante der UCI-Engine unberhrt bleiben
+		ChessEngine engine;
+
+		BenchmarkResult result;
+
+		for (const auto* fen : BENCH_FENS)
+		{
+			// Jede Stellung ohne Wissen aus der vorherigen Suche durchsuchen
+			engine.newGame();
+			engine.getPosition() = ChessUtility::fenToPosition(fen);
+
+			auto start = std::chrono::steady_clock::now();
+
+			engine.prepareSearch();
+			engine.searchMove(engine.getPosition().getPlayer(), depth, FT_STANDARD);
+
+			auto time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+			result.nodes += engine.getNodesCount();
+			result.time += time;
+			result.positions++;
+
+			if (callback) callback(result.positions, fen, engine.getNodesCount(), time);
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "defines.hpp"
+
+namespace owl
+{
+	constexpr INT32 BENCH_DEFAULT_DEPTH = 5;	// Suchtiefe je Stellung
+
+	// Feste Stellungen des Benchmarks: Kasparov gegen Topalov (siehe test::TestEvaluation), Perft-Stellungen und Endspiele
+	constexpr const CHAR* BENCH_FENS[] = {
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"rnbqk2r/ppp1ppbp/3p1np1/8/3PP3/2N1B3/PPP2PPP/R2QKBNR w KQkq - 2 5",
+		"r1bqk2r/p2nppbp/2pp1np1/1p6/3PP3/2N1BP2/PPPQN1PP/R3KB1R w KQkq - 2 8",
+		"r3k2r/pb1nqp1p/2pp1npQ/1p2p3/3PP3/P1N2P2/1PP1N1PP/2KR1B1R w kq - 2 12",
+		"2kr3r/1b1nqp1p/p1pp1npQ/1p6/3pP3/PNN2P2/1PP3PP/1K1R1B1R w - - 0 15",
+		"bk1r3r/4qp1p/pn1p1npQ/Npp5/4P3/P1N2PP1/1PP4P/1K1R1B1R w - - 3 19",
+		"b2r3r/k3qp1p/pn3np1/NppN4/3pPQ2/P4PPB/1PP4P/1K1RR3 b - - 1 22",
+		"b2r3r/4Rp1p/pk1q1np1/Np1P4/3p1Q2/P4PPB/1PP4P/1K6 w - - 2 26",
+		"3r3r/1R3p1p/Q5p1/1p6/1kq5/5PPB/2P4P/1K6 w - - 0 33",
+		"7r/3r1p1p/6p1/1p6/2B5/5PP1/1Q5P/1K1k4 b - - 0 38",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+		"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+		"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+		"8/8/1p3k2/p1p2p2/P1P2P2/1P3K2/8/8 w - - 0 1",
+		"8/8/8/4k3/8/8/4P3/4K3 w - - 0 1",
+	};
+
+	/**
+	 * Ergebnis eines Benchmarks.
+	 */
+	struct BenchmarkResult
+	{
+		INT64 nodes = 0;	// Summe der durchsuchten Knoten (Signatur des Suchverhaltens)
+		INT64 time = 0;		// Summe der Suchzeiten in ms
+		INT32 positions = 0;	// Anzahl der durchsuchten Stellungen
+
+		/**
+		 * Durchsuchte Knoten pro Sekunde.
+		 */
+		INT64 getNodesPerSecond() const;
+	};
+
+	using BENCH_POSITION_CALLBACK = std::function<VOID(INT32 index, const std::string& fen, INT64 nodes, INT64 time)>; // Rckruffunktion je Stellung
+
+	/**
+	 * Benchmark der Suche: Alle Stellungen aus BENCH_FENS werden mit einer eigenen Engine und geleerten Zwischenspeichern
+	 * bis zur festen Tiefe durchsucht. Die Summe der Knoten ist deterministisch und ndert sich nur, wenn sich das Suchverhalten ndert.
+	 */
+	class Benchmark
+	{
+	public:
+		/**
+		 * Benchmark ausfhren.
+		 *
+		 * \param depth Suchtiefe je Stellung
+		 * \param callback Wird nach jeder Stellung aufgerufen (optional)
+		 * \return Knoten und Suchzeit aller Stellungen
+		 */
+		static BenchmarkResult run(INT32 depth, const BENCH_POSITION_CALLBACK& callback = nullptr);
+	};
+}
@@ -0,0 +1,303 @@
+#include "Bitbase.hpp"
+#include "Bitboard.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+namespace owl
+{
+	namespace
+	{
+		constexpr CHAR BITBASE_MAGIC[] = { 'O', 'W', 'L', 'B', 'B', 'v', '0', '1' }; // Kennung im Dateikopf
+		constexpr size_t BITBASE_HEADER_SIZE = sizeof(BITBASE_MAGIC);
+		constexpr size_t BITBASE_FILE_SIZE = BITBASE_HEADER_SIZE + static_cast<size_t>(BITBASE_TYPES) * BITBASE_BYTES;
+
+		// Zustnde whrend der Retrograden Analyse
+		constexpr UCHAR STATE_INVALID = 0;	// Stellung nicht mglich
+		constexpr UCHAR STATE_UNKNOWN = 1;	// Noch kein Gewinn gefunden
+		constexpr UCHAR STATE_DRAW = 2;		// Patt
+		constexpr UCHAR STATE_WIN = 3;		// Gewinn fr Wei
+
+		/**
+		 * Ist das Bit einer Stellung gesetzt?
+		 */
+		inline BOOL IS_WIN(const UCHAR* bits, INT32 index)
+		{
+			return (bits[index >> 3] >> (index & 7)) & 1;
+		}
+
+		/**
+		 * Angriffe der weien Figur.
+		 */
+		inline BITBOARD PIECE_ATTACKS(BitbaseType type, INT32 square, BITBOARD occupied)
+		{
+			switch (type)
+			{
+			case BitbaseType::KPK: return bitboard::PAWN_ATTACKS(WHITE_INDEX, 1ULL << square);
+			case BitbaseType::KRK: return bitboard::ROOK_ATTACKS(square, occupied);
+			default: return bitboard::ROOK_ATTACKS(square, occupied) | bitboard::BISHOP_ATTACKS(square, occupied);
+			}
+		}
+
+		/**
+		 * Zugziele des schwarzen Knigs (die Figur darf geschlagen werden, falls sie nicht gedeckt ist).
+		 */
+		inline BITBOARD BLACK_KING_TARGETS(BitbaseType type, INT32 piece, INT32 whiteKing, INT32 blackKing)
+		{
+			// Ohne den schwarzen Knig, damit er nicht entlang eines Angriffsstrahls ausweichen kann
+			auto occupied = (1ULL << piece) | (1ULL << whiteKing);
+			return bitboard::KING_ATTACKS[blackKing] & ~bitboard::KING_ATTACKS[whiteKing] & ~PIECE_ATTACKS(type, piece, occupied);
+		}
+
+		/**
+		 * Ist die Stellung mglich? Ausgeschlossen sind belegte Felder, benachbarte Knige, ein Bauer auf der Grundreihe
+		 * und ein schwarzer Knig im Schach, wenn Wei am Zug ist.
+		 */
+		inline BOOL IS_VALID(BitbaseType type, INT32 color, INT32 piece, INT32 whiteKing, INT32 blackKing)
+		{
+			if (piece == whiteKing || piece == blackKing || whiteKing == blackKing) return false;
+			if (bitboard::KING_ATTACKS[whiteKing] & (1ULL << blackKing)) return false;
+			if (type == BitbaseType::KPK && (piece / COLUMNS == FIRST_ROW_INDEX || piece / COLUMNS == LAST_ROW_INDEX)) return false;
+
+			auto occupied = (1ULL << piece) | (1ULL << whiteKing) | (1ULL << blackKing);
+			return color == BLACK_INDEX || !(PIECE_ATTACKS(type, piece, occupied) & (1ULL << blackKing));
+		}
+	}
+
+	MemoryMappedFile Bitbase::s_file;
+	std::vector<UCHAR> Bitbase::s_generated;
+	const UCHAR* Bitbase::s_data = nullptr;
+
+	VOID Bitbase::init(const std::string& path, BOOL regenerate)
+	{
+		s_data = nullptr;
+		s_file.close();
+		s_generated.clear();
+
+		auto valid_file = [](const MemoryMappedFile& file) {
+			return file.getSize() == BITBASE_FILE_SIZE && std::equal(std::begin(BITBASE_MAGIC), std::end(BITBASE_MAGIC), file.getData());
+		};
+
+		if (!regenerate && s_file.open(path) && valid_file(s_file))
+		{
+			s_data = s_file.getData() + BITBASE_HEADER_SIZE;
+			return;
+		}
+		s_file.close();
+
+		auto bitbases = generate();
+
+		// Gespeicherte Datei einblenden, andernfalls (z.B. ohne Schreibrechte) die erzeugten Daten direkt verwenden
+		if (write(path, bitbases) && s_file.open(path) && valid_file(s_file))
+		{
+			s_data = s_file.getData() + BITBASE_HEADER_SIZE;
+		}
+		else
+		{
+			s_file.close();
+			s_generated = std::move(bitbases);
+			s_data = s_generated.data();
+		}
+	}
+
+	BOOL Bitbase::isLoaded()
+	{
+		return s_data != nullptr;
+	}
+
+	GameState Bitbase::probe(const Position& position)
+	{
+		if (!s_data) return GameState::Active;
+
+		// Genau eine Figur auer den Knigen?
+		const auto& piece_count = position.getIncrementalEvaluation().pieceCount;
+		INT32 strong = -1, type = -1;
+		for (INT32 color = FIRST_PLAYER_INDEX; color < PLAYER_COUNT; color++)
+		{
+			for (INT32 piece = FIRST_PIECE_TYPES_INDEX; piece < KING_INDEX; piece++)
+			{
+				if (piece_count[color][piece] == 0) continue;
+				if (strong != -1 || piece_count[color][piece] > 1) return GameState::Active;
+				strong = color;
+				type = piece;
+			}
+		}
+
+		BitbaseType bitbase;
+		switch (type)
+		{
+		case PAWN_INDEX: bitbase = BitbaseType::KPK; break;
+		case ROOK_INDEX: bitbase = BitbaseType::KRK; break;
+		case QUEEN_INDEX: bitbase = BitbaseType::KQK; break;
+		default: return GameState::Active;
+		}
+
+		// Ohne beide Knige (nach dem Schlagen eines Knigs in der Suche) gibt es keinen Index
+		if (!position.getBitboard(WHITE_INDEX, KING_INDEX) || !position.getBitboard(BLACK_INDEX, KING_INDEX)) return GameState::Active;
+
+		// Fr die strkere Seite Schwarz an der Mittellinie spiegeln
+		auto flip = strong == BLACK_INDEX ? (LAST_ROW_INDEX * COLUMNS) : 0;
+		auto piece = bitboard::MSB(position.getBitboard(strong, type)) ^ flip;
+		auto white_king = bitboard::MSB(position.getBitboard(strong, KING_INDEX)) ^ flip;
+		auto black_king = bitboard::MSB(position.getBitboard(1 - strong, KING_INDEX)) ^ flip;
+		auto player = position.getPlayer() == PLAYER_WHITE ? WHITE_INDEX : BLACK_INDEX;
+		auto color = player == strong ? WHITE_INDEX : BLACK_INDEX;
+
+		// Ungltige Stellungen (z.B. benachbarte Knige) sind in der Bitbasis nicht als Remis zu lesen
+		if (!IS_VALID(bitbase, color, piece, white_king, black_king)) return GameState::Active;
+
+		auto bits = s_data + static_cast<size_t>(bitbase) * BITBASE_BYTES;
+		if (!IS_WIN(bits, getIndex(color, piece, white_king, black_king))) return GameState::Remis;
+
+		return strong == WHITE_INDEX ? GameState::PlayerWhiteWins : GameState::PlayerBlackWins;
+	}
+
+	INT32 Bitbase::getIndex(INT32 color, INT32 piece, INT32 whiteKing, INT32 blackKing)
+	{
+		return ((color * BITBASE_SQUARES + piece) * BITBASE_SQUARES + whiteKing) * BITBASE_SQUARES + blackKing;
+	}
+
+	std::vector<UCHAR> Bitbase::generate()
+	{
+		std::vector<UCHAR> bitbases(static_cast<size_t>(BITBASE_TYPES) * BITBASE_BYTES, 0);
+
+		for (auto type : { BitbaseType::KQK, BitbaseType::KRK, BitbaseType::KPK })
+		{
+			solve(type, bitbases, bitbases.data() + static_cast<size_t>(type) * BITBASE_BYTES);
+		}
+
+		return bitbases;
+	}
+
+	VOID Bitbase::solve(BitbaseType type, const std::vector<UCHAR>& bitbases, UCHAR* bits)
+	{
+		std::vector<UCHAR> states(BITBASE_POSITIONS, STATE_INVALID);
+		std::vector<UCHAR> next;
+
+		const auto queen_bits = bitbases.data() + static_cast<size_t>(BitbaseType::KQK) * BITBASE_BYTES;
+		const auto rook_bits = bitbases.data() + static_cast<size_t>(BitbaseType::KRK) * BITBASE_BYTES;
+
+		// Ausgangszustand: Ungltige Stellungen, Matt und Patt
+		auto initialize = [&](INT32 index) {
+			auto black_king = index % BITBASE_SQUARES;
+			auto white_king = index / BITBASE_SQUARES % BITBASE_SQUARES;
+			auto piece = index / (BITBASE_SQUARES * BITBASE_SQUARES) % BITBASE_SQUARES;
+			auto color = index / (BITBASE_SQUARES * BITBASE_SQUARES * BITBASE_SQUARES);
+
+			if (!IS_VALID(type, color, piece, white_king, black_king)) return STATE_INVALID;
+			if (color == WHITE_INDEX) return STATE_UNKNOWN;
+
+			auto occupied = (1ULL << piece) | (1ULL << white_king) | (1ULL << black_king);
+			auto check = (PIECE_ATTACKS(type, piece, occupied) & (1ULL << black_king)) != 0;
+
+			if (BLACK_KING_TARGETS(type, piece, white_king, black_king)) return STATE_UNKNOWN;
+			return check ? STATE_WIN : STATE_DRAW;
+		};
+
+		// Eine Stellung mit den Ergebnissen der letzten Iteration auswerten
+		auto evaluate = [&](INT32 index) {
+			auto black_king = index % BITBASE_SQUARES;
+			auto white_king = index / BITBASE_SQUARES % BITBASE_SQUARES;
+			auto piece = index / (BITBASE_SQUARES * BITBASE_SQUARES) % BITBASE_SQUARES;
+			auto color = index / (BITBASE_SQUARES * BITBASE_SQUARES * BITBASE_SQUARES);
+
+			if (color == BLACK_INDEX)
+			{
+				// Schwarz verliert, wenn jeder Zug in eine gewonnene Stellung fhrt (Schlagen der Figur ist Remis)
+				BITBOARD targets = BLACK_KING_TARGETS(type, piece, white_king, black_king);
+				while (targets)
+				{
+					auto target = bitboard::POP_LSB(targets);
+					if (target == piece || states[getIndex(WHITE_INDEX, piece, white_king, target)] != STATE_WIN) return false;
+				}
+				return true;
+			}
+
+			// Wei gewinnt, wenn ein Zug in eine gewonnene Stellung fhrt
+			BITBOARD king_targets = bitboard::KING_ATTACKS[white_king] & ~bitboard::KING_ATTACKS[black_king] & ~(1ULL << piece);
+			while (king_targets)
+			{
+				if (states[getIndex(BLACK_INDEX, piece, bitboard::POP_LSB(king_targets), black_king)] == STATE_WIN) return true;
+			}
+
+			BITBOARD occupied = (1ULL << white_king) | (1ULL << black_king);
+			if (type != BitbaseType::KPK)
+			{
+				BITBOARD piece_targets = PIECE_ATTACKS(type, piece, occupied) & ~occupied;
+				while (piece_targets)
+				{
+					if (states[getIndex(BLACK_INDEX, bitboard::POP_LSB(piece_targets), white_king, black_king)] == STATE_WIN) return true;
+				}
+				return false;
+			}
+
+			// Bauer: Wei zieht zu kleineren Indizes
+			auto target = piece - COLUMNS;
+			if (occupied & (1ULL << target)) return false;
+
+			if (target / COLUMNS == FIRST_ROW_INDEX)
+			{
+				auto promotion = getIndex(BLACK_INDEX, target, white_king, black_king);
+				return IS_WIN(queen_bits, promotion) || IS_WIN(rook_bits, promotion);
+			}
+			if (states[getIndex(BLACK_INDEX, target, white_king, black_king)] == STATE_WIN) return true;
+
+			// Doppelschritt aus der Grundstellung
+			auto double_target = target - COLUMNS;
+			return piece / COLUMNS == LAST_ROW_INDEX - 1 && !(occupied & (1ULL << double_target))
+				&& states[getIndex(BLACK_INDEX, double_target, white_king, black_king)] == STATE_WIN;
+		};
+
+		// Indexbereiche auf alle Threads verteilen
+		auto thread_count = std::max(1U, std::thread::hardware_concurrency());
+		auto parallel = [thread_count](auto&& work) {
+			std::vector<std::thread> threads;
+			auto chunk = (BITBASE_POSITIONS + static_cast<INT32>(thread_count) - 1) / static_cast<INT32>(thread_count);
+			for (UINT32 t = 0; t < thread_count; t++)
+			{
+				auto begin = static_cast<INT32>(t) * chunk;
+				auto end = std::min(BITBASE_POSITIONS, begin + chunk);
+				threads.emplace_back([&work, begin, end]() { for (auto index = begin; index < end; index++) work(index); });
+			}
+			for (auto& thread : threads) thread.join();
+		};
+
+		parallel([&](INT32 index) { states[index] = initialize(index); });
+
+		// Bis keine neue gewonnene Stellung mehr gefunden wird
+		std::atomic<INT32> changed;
+		do
+		{
+			changed = 0;
+			next = states;
+			parallel([&](INT32 index) {
+				if (states[index] == STATE_UNKNOWN && evaluate(index))
+				{
+					next[index] = STATE_WIN;
+					changed.fetch_add(1, std::memory_order_relaxed);
+				}
+			});
+			states.swap(next);
+		} while (changed > 0);
+
+		std::memset(bits, 0, BITBASE_BYTES);
+		for (INT32 index = 0; index < BITBASE_POSITIONS; index++)
+		{
+			if (states[index] == STATE_WIN) bits[index >> 3] |= static_cast<UCHAR>(1 << (index & 7));
+		}
+	}
+
+	BOOL Bitbase::write(const std::string& path, const std::vector<UCHAR>& bitbases)
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (!file) return false;
+
+		file.write(BITBASE_MAGIC, BITBASE_HEADER_SIZE);
+		file.write(reinterpret_cast<const CHAR*>(bitbases.data()), static_cast<std::streamsize>(bitbases.size()));
+
+		return static_cast<BOOL>(file);
+	}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "defines.hpp"
+#include "MemoryMappedFile.hpp"
+#include "Position.hpp"
+
+namespace owl
+{
+	constexpr INT32 BITBASE_SQUARES = ROWS * COLUMNS; // Anzahl der Felder
+	constexpr INT32 BITBASE_POSITIONS = PLAYER_COUNT * BITBASE_SQUARES * BITBASE_SQUARES * BITBASE_SQUARES; // Seite am Zug, Figur, Knige
+	constexpr INT32 BITBASE_BYTES = BITBASE_POSITIONS / 8; // Ein Bit je Stellung (gesetzt: Gewinn fr die strkere Seite)
+	constexpr const CHAR* BITBASE_FILE = "owl_bitbases.bin"; // Zwischengespeicherte Bitbasen im Arbeitsverzeichnis
+	constexpr EVALUATION_VALUE BITBASE_WIN_VALUE = 10000; // Bonus fr eine gewonnene Stellung laut Bitbasis (unterhalb der Mattwerte)
+
+	/**
+	 * Materialverteilungen der Bitbasen (Knig und eine Figur gegen Knig).
+	 */
+	enum class BitbaseType
+	{
+		KPK = 0,	// Knig und Bauer gegen Knig
+		KRK = 1,	// Knig und Turm gegen Knig
+		KQK = 2		// Knig und Dame gegen Knig
+	};
+
+	constexpr INT32 BITBASE_TYPES = 3; // Anzahl der Bitbasen
+
+	/**
+	 * Kleine Endspiel-Bitbasen fr KPK, KRK und KQK. Sie speichern je Stellung nur, ob die strkere Seite gewinnt,
+	 * und werden durch parallele Retrograde Analyse erzeugt und als Datei zwischengespeichert (3 * 64 KB).
+	 * Die strkere Seite wird immer als Wei gespeichert, fr Schwarz wird die Stellung an der Mittellinie gespiegelt.
+	 */
+	class Bitbase
+	{
+	public:
+		/**
+		 * Bitbasen aus der Datei einblenden. Fehlt die Datei oder ist sie ungltig, werden die Bitbasen erzeugt und gespeichert.
+		 *
+		 * \param path Dateipfad
+		 * \param regenerate Bitbasen auch bei vorhandener Datei neu erzeugen
+		 */
+		static VOID init(const std::string& path, BOOL regenerate = false);
+		/**
+		 * Sind die Bitbasen verfgbar?
+		 */
+		static BOOL isLoaded();
+		/**
+		 * Ergebnis einer Stellung aus den Bitbasen.
+		 *
+		 * \param position Stellung
+		 * \return Sieg einer Seite, Remis oder GameState::Active (Materialverteilung nicht abgedeckt oder Stellung ungltig)
+		 */
+		static GameState probe(const Position& position);
+		/**
+		 * Index einer Stellung in einer Bitbasis. Die strkere Seite ist Wei.
+		 *
+		 * \param color Seite am Zug (WHITE_INDEX: strkere Seite)
+		 * \param piece Feld der Figur (y * COLUMNS + x)
+		 * \param whiteKing Feld des weien Knigs
+		 * \param blackKing Feld des schwarzen Knigs
+		 * \return Index
+		 */
+		static INT32 getIndex(INT32 color, INT32 piece, INT32 whiteKing, INT32 blackKing);
+	private:
+		static MemoryMappedFile s_file; // Eingeblendete Bitbasen
+		static std::vector<UCHAR> s_generated; // Erzeugte Bitbasen, falls die Datei nicht geschrieben werden konnte
+		static const UCHAR* s_data; // Beginn der Bitbasen (Datei oder s_generated)
+		/**
+		 * Alle Bitbasen erzeugen (KQK und KRK zuerst, da KPK bei einer Umwandlung auf sie zugreift).
+		 *
+		 * \return Bitbasen hintereinander, je BITBASE_BYTES
+		 */
+		static std::vector<UCHAR> generate();
+		/**
+		 * Eine Bitbasis durch Retrograde Analyse lsen. Alle Stellungen werden je Iteration auf mehrere Threads verteilt
+		 * und als Gewinn markiert, sobald Wei einen Zug in eine gewonnene Stellung hat bzw. Schwarz nur solche Zge,
+		 * bis sich keine Stellung mehr ndert. brige Stellungen sind Remis.
+		 *
+		 * \param type Materialverteilung
+		 * \param bitbases Bereits erzeugte Bitbasen (fr die Umwandlung in KPK)
+		 * \param bits Rckgabe der Bitbasis
+		 */
+		static VOID solve(BitbaseType type, const std::vector<UCHAR>& bitbases, UCHAR* bits);
+		/**
+		 * Bitbasen in eine Datei schreiben.
+		 *
+		 * \param path Dateipfad
+		 * \param bitbases Bitbasen
+		 * \return Erfolgreich?
+		 */
+		static BOOL write(const std::string& path, const std::vector<UCHAR>& bitbases);
+	};
+}
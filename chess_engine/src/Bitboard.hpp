@@ -0,0 +1,303 @@
+#pragma once
+
+#include <array>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "defines.hpp"
+
+namespace owl
+{
+	using BITBOARD = UINT64; // Ein Bit pro Feld, Index y * COLUMNS + x (Bit 0 = a8, Bit 63 = h1)
+
+	/**
+	 * Bitboards und Operationen auf dem ganzen Spielfeld (Verschiebungen, Auffllen, Bauernangriffe)
+	 * sowie vorberechnete Angriffsfelder fr Springer, Knig und Strahlen der Langschrittler.
+	 * Da Reihe 0 die achte Reihe ist, zieht Wei in Richtung kleinerer Bit-Indizes (Verschiebung nach rechts).
+	 */
+	namespace bitboard
+	{
+		constexpr BITBOARD EMPTY_BOARD = 0ULL; // Leeres Bitboard
+		constexpr BITBOARD FILE_A = 0x0101010101010101ULL; // Linie A
+		constexpr BITBOARD FILE_H = FILE_A << LAST_COLUMN_INDEX; // Linie H
+
+		/**
+		 * Bitboard mit genau einem gesetzten Feld.
+		 *
+		 * \param x Spalte
+		 * \param y Reihe
+		 * \return Bitboard des Feldes
+		 */
+		constexpr BITBOARD SQUARE(INT32 x, INT32 y)
+		{
+			return 1ULL << (y * COLUMNS + x);
+		}
+
+		/**
+		 * Bitboard aller Felder einer Reihe.
+		 *
+		 * \param y Reihe
+		 * \return Bitboard der Reihe
+		 */
+		constexpr BITBOARD ROW(INT32 y)
+		{
+			return 0xFFULL << (y * COLUMNS);
+		}
+
+		/**
+		 * Alle Felder um eine Spalte nach rechts (Richtung Linie H) verschieben.
+		 */
+		constexpr BITBOARD SHIFT_EAST(BITBOARD board)
+		{
+			return (board << 1) & ~FILE_A;
+		}
+
+		/**
+		 * Alle Felder um eine Spalte nach links (Richtung Linie A) verschieben.
+		 */
+		constexpr BITBOARD SHIFT_WEST(BITBOARD board)
+		{
+			return (board >> 1) & ~FILE_H;
+		}
+
+		/**
+		 * Alle Felder um eine Reihe in Zugrichtung eines Spielers verschieben.
+		 *
+		 * \param color Spielerfarbe (WHITE_INDEX, BLACK_INDEX)
+		 * \param board Bitboard
+		 * \return Verschobenes Bitboard
+		 */
+		constexpr BITBOARD SHIFT_FORWARD(INT32 color, BITBOARD board)
+		{
+			return color == WHITE_INDEX ? board >> COLUMNS : board << COLUMNS;
+		}
+
+		/**
+		 * Alle Felder um eine Reihe entgegen der Zugrichtung eines Spielers verschieben.
+		 */
+		constexpr BITBOARD SHIFT_BACKWARD(INT32 color, BITBOARD board)
+		{
+			return SHIFT_FORWARD(color == WHITE_INDEX ? BLACK_INDEX : WHITE_INDEX, board);
+		}
+
+		/**
+		 * Alle Felder in Zugrichtung eines Spielers bis zum Brettrand auffllen (einschlielich der Felder selbst).
+		 */
+		constexpr BITBOARD FILL_FORWARD(INT32 color, BITBOARD board)
+		{
+			if (color == WHITE_INDEX)
+			{
+				board |= board >> 8;
+				board |= board >> 16;
+				board |= board >> 32;
+			}
+			else
+			{
+				board |= board << 8;
+				board |= board << 16;
+				board |= board << 32;
+			}
+			return board;
+		}
+
+		/**
+		 * Alle Felder vor den Feldern in Zugrichtung eines Spielers (ohne die Felder selbst).
+		 */
+		constexpr BITBOARD FRONT_SPAN(INT32 color, BITBOARD board)
+		{
+			return FILL_FORWARD(color, SHIFT_FORWARD(color, board));
+		}
+
+		/**
+		 * Alle Felder auf den Linien der Felder.
+		 */
+		constexpr BITBOARD FILL_FILE(BITBOARD board)
+		{
+			return FILL_FORWARD(WHITE_INDEX, board) | FILL_FORWARD(BLACK_INDEX, board);
+		}
+
+		/**
+		 * Von Bauern eines Spielers angegriffene Felder.
+		 *
+		 * \param color Spielerfarbe der Bauern (WHITE_INDEX, BLACK_INDEX)
+		 * \param pawns Bitboard der Bauern
+		 * \return Angegriffene Felder
+		 */
+		constexpr BITBOARD PAWN_ATTACKS(INT32 color, BITBOARD pawns)
+		{
+			auto forward = SHIFT_FORWARD(color, pawns);
+			return SHIFT_EAST(forward) | SHIFT_WEST(forward);
+		}
+
+		constexpr INT32 SQUARE_COUNT = ROWS * COLUMNS; // Anzahl der Felder
+		constexpr INT32 LAST_SQUARE_INDEX = SQUARE_COUNT - 1; // Index des letzten Feldes
+		constexpr INT32 DIRECTION_COUNT = 8; // Anzahl der Strahlrichtungen
+
+		// Strahlrichtungen als Verschiebung in x und y. Richtungen mit positivem Index-Versatz (y * COLUMNS + x) stehen zuerst.
+		constexpr INT32 RAY_SOUTH = 0, RAY_EAST = 1, RAY_SOUTH_EAST = 2, RAY_SOUTH_WEST = 3;
+		constexpr INT32 RAY_NORTH = 4, RAY_WEST = 5, RAY_NORTH_EAST = 6, RAY_NORTH_WEST = 7;
+		constexpr INT32 FIRST_NEGATIVE_RAY = RAY_NORTH; // Erste Richtung mit negativem Index-Versatz
+		constexpr INT32 RAY_X[DIRECTION_COUNT] = { 0, 1, 1, -1, 0, -1, 1, -1 }; // Verschiebung in x je Richtung
+		constexpr INT32 RAY_Y[DIRECTION_COUNT] = { 1, 0, 1, 1, -1, 0, -1, -1 }; // Verschiebung in y je Richtung
+
+		/**
+		 * Erzeuge die Felder, die von einem Feld aus mit festen Sprngen erreicht werden (Springer, Knig).
+		 *
+		 * \param offsetsX Verschiebungen in x
+		 * \param offsetsY Verschiebungen in y
+		 * \return Angriffsfelder je Feld
+		 */
+		template<size_t N>
+		constexpr std::array<BITBOARD, SQUARE_COUNT> GENERATE_STEP_ATTACKS(const INT32(&offsetsX)[N], const INT32(&offsetsY)[N])
+		{
+			std::array<BITBOARD, SQUARE_COUNT> attacks = {};
+			for (auto y = FIRST_ROW_INDEX; y < ROWS; y++)
+			{
+				for (auto x = FIRST_COLUMN_INDEX; x < COLUMNS; x++)
+				{
+					for (size_t i = 0; i < N; i++)
+					{
+						auto target_x = x + offsetsX[i];
+						auto target_y = y + offsetsY[i];
+						if (target_x >= FIRST_COLUMN_INDEX && target_x < COLUMNS && target_y >= FIRST_ROW_INDEX && target_y < ROWS)
+							attacks[y * COLUMNS + x] |= SQUARE(target_x, target_y);
+					}
+				}
+			}
+			return attacks;
+		}
+
+		/**
+		 * Erzeuge die Strahlen aller Richtungen bis zum Brettrand (ohne das Startfeld).
+		 */
+		constexpr std::array<std::array<BITBOARD, SQUARE_COUNT>, DIRECTION_COUNT> GENERATE_RAYS()
+		{
+			std::array<std::array<BITBOARD, SQUARE_COUNT>, DIRECTION_COUNT> rays = {};
+			for (auto direction = 0; direction < DIRECTION_COUNT; direction++)
+			{
+				for (auto y = FIRST_ROW_INDEX; y < ROWS; y++)
+				{
+					for (auto x = FIRST_COLUMN_INDEX; x < COLUMNS; x++)
+					{
+						auto target_x = x + RAY_X[direction];
+						auto target_y = y + RAY_Y[direction];
+						while (target_x >= FIRST_COLUMN_INDEX && target_x < COLUMNS && target_y >= FIRST_ROW_INDEX && target_y < ROWS)
+						{
+							rays[direction][y * COLUMNS + x] |= SQUARE(target_x, target_y);
+							target_x += RAY_X[direction];
+							target_y += RAY_Y[direction];
+						}
+					}
+				}
+			}
+			return rays;
+		}
+
+		constexpr INT32 KNIGHT_OFFSETS_X[] = { 1, 2, 2, 1, -1, -2, -2, -1 }; // Springersprnge in x
+		constexpr INT32 KNIGHT_OFFSETS_Y[] = { -2, -1, 1, 2, 2, 1, -1, -2 }; // Springersprnge in y
+		constexpr INT32 KING_OFFSETS_X[] = { 0, 1, 1, 1, 0, -1, -1, -1 }; // Knigsschritte in x
+		constexpr INT32 KING_OFFSETS_Y[] = { -1, -1, 0, 1, 1, 1, 0, -1 }; // Knigsschritte in y
+
+		constexpr std::array<BITBOARD, SQUARE_COUNT> KNIGHT_ATTACKS = GENERATE_STEP_ATTACKS(KNIGHT_OFFSETS_X, KNIGHT_OFFSETS_Y); // Springerangriffe je Feld
+		constexpr std::array<BITBOARD, SQUARE_COUNT> KING_ATTACKS = GENERATE_STEP_ATTACKS(KING_OFFSETS_X, KING_OFFSETS_Y); // Knigsangriffe je Feld
+		constexpr std::array<std::array<BITBOARD, SQUARE_COUNT>, DIRECTION_COUNT> RAYS = GENERATE_RAYS(); // Strahlen je Richtung und Feld
+
+		/**
+		 * Anzahl der gesetzten Felder.
+		 */
+		inline INT32 POP_COUNT(BITBOARD board)
+		{
+		#if defined(_MSC_VER)
+			return static_cast<INT32>(__popcnt64(board));
+		#else
+			return __builtin_popcountll(board);
+		#endif
+		}
+
+		/**
+		 * Index des niedrigsten gesetzten Feldes entfernen und zurckgeben.
+		 *
+		 * \param board Bitboard (nicht leer)
+		 * \return Index des Feldes (y * COLUMNS + x)
+		 */
+		inline INT32 POP_LSB(BITBOARD& board)
+		{
+		#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward64(&index, board);
+		#else
+			auto index = __builtin_ctzll(board);
+		#endif
+			board &= board - 1;
+			return static_cast<INT32>(index);
+		}
+
+		/**
+		 * Index des hchsten gesetzten Feldes.
+		 *
+		 * \param board Bitboard (nicht leer)
+		 * \return Index des Feldes (y * COLUMNS + x)
+		 */
+		inline INT32 MSB(BITBOARD board)
+		{
+		#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanReverse64(&index, board);
+			return static_cast<INT32>(index);
+		#else
+			return LAST_SQUARE_INDEX - __builtin_clzll(board);
+		#endif
+		}
+
+		/**
+		 * Angriffe entlang eines Strahls bis einschlielich der ersten blockierenden Figur.
+		 *
+		 * \param direction Richtung (RAY_*)
+		 * \param square Startfeld (y * COLUMNS + x)
+		 * \param occupied Alle besetzten Felder
+		 * \return Angegriffene Felder
+		 */
+		inline BITBOARD RAY_ATTACKS(INT32 direction, INT32 square, BITBOARD occupied)
+		{
+			auto attacks = RAYS[direction][square];
+			auto blockers = attacks & occupied;
+
+			if (blockers)
+			{
+				// Erste Figur in Strahlrichtung: niedrigstes Bit bei positivem, hchstes Bit bei negativem Versatz
+				auto blocker = direction < FIRST_NEGATIVE_RAY ? POP_LSB(blockers) : MSB(blockers);
+				attacks ^= RAYS[direction][blocker];
+			}
+
+			return attacks;
+		}
+
+		/**
+		 * Angriffe eines Lufers.
+		 *
+		 * \param square Feld (y * COLUMNS + x)
+		 * \param occupied Alle besetzten Felder
+		 * \return Angegriffene Felder
+		 */
+		inline BITBOARD BISHOP_ATTACKS(INT32 square, BITBOARD occupied)
+		{
+			return RAY_ATTACKS(RAY_SOUTH_EAST, square, occupied) | RAY_ATTACKS(RAY_SOUTH_WEST, square, occupied)
+				| RAY_ATTACKS(RAY_NORTH_EAST, square, occupied) | RAY_ATTACKS(RAY_NORTH_WEST, square, occupied);
+		}
+
+		/**
+		 * Angriffe eines Turms.
+		 *
+		 * \param square Feld (y * COLUMNS + x)
+		 * \param occupied Alle besetzten Felder
+		 * \return Angegriffene Felder
+		 */
+		inline BITBOARD ROOK_ATTACKS(INT32 square, BITBOARD occupied)
+		{
+			return RAY_ATTACKS(RAY_SOUTH, square, occupied) | RAY_ATTACKS(RAY_EAST, square, occupied)
+				| RAY_ATTACKS(RAY_NORTH, square, occupied) | RAY_ATTACKS(RAY_WEST, square, occupied);
+		}
+	}
+}
@@ -1,6 +1,8 @@
 #include "ChessEngine.hpp"
 #include "ChessValidation.hpp"
 #include "ChessEvaluation.hpp"
+#include "Bitbase.hpp"
+#include "OpeningBook.hpp"
 
 #include <algorithm>
 #include <chrono>
@@ -12,50 +14,200 @@ namespace owl
 	//static MinMaxResult m_result;
 
 	ChessEngine::ChessEngine()
-		: m_player(0)
+		: m_evaluationCache(std::make_unique<EvaluationCache>()),
+		m_pawnHashTable(std::make_unique<PawnHashTable>()),
+		m_player(0)
 	{
 		ChessValidation::init();
+		// Weitere Engines (z.B. fr den Benchmark) verwenden die bereits eingeblendeten Bitbasen
+		if (!Bitbase::isLoaded()) Bitbase::init(BITBASE_FILE);
 	}
 	ChessEngine::~ChessEngine()
 	{
 	}
 
-	PAIR<Move, EVALUATION_VALUE> ChessEngine::searchMove(INT32 player, INT32 depth, UCHAR parameterFlags)
+	PAIR<Move, EVALUATION_VALUE> ChessEngine::searchMove(INT32 player, INT32 depth, UCHAR parameterFlags, const SearchLimits& limits)
 	{
 		m_mutex.lock();
 
+		// Das Stop-Signal wird nicht zurckgesetzt (siehe prepareSearch), ein vorzeitiges stop() bleibt erhalten
 		m_ready = false;
-		m_stop = false;
-		m_startedDepth = depth;
+		m_limits = limits;
 		m_repitionMap.addPosition(m_position);
-		if(m_player == 0) m_player = player;
+		// Es wird immer fr den Spieler am Zug gesucht (z.B. bei der Analyse beider Seiten)
+		m_player = player;
 
 		// Testwerte fr Effizienz:
 		m_nodes = 0;
 		m_prunes = 0;
+		m_selDepth = 0;
+		m_lastCurrMoveReport = 0;
+		m_killerList = KILLER_LIST();
+		m_statistics.clear();
+
+		INT32 multi_pv = getMultiPV();
 
 		m_mutex.unlock();
 
-		auto time_start = std::chrono::steady_clock::now();
+		// Hauptvariante der letzten Suche weiterverwenden, sofern beide Seiten ihr gefolgt sind
+		MOVE_LIST previous_pv;
+		auto move_data_stack = m_position.getMoveDataStack();
+		if (m_previousPv.size() > 2 && move_data_stack.size() >= 2)
+		{
+			auto last_move = move_data_stack.top().move;
+			move_data_stack.pop();
+
+			if (move_data_stack.top().move == m_previousPv[0] && last_move == m_previousPv[1])
+			{
+				previous_pv.assign(m_previousPv.begin() + 2, m_previousPv.end());
+			}
+		}
+		m_previousPv = previous_pv;
 
+		// Analysemodus: Bis zur maximalen Suchtiefe vertiefen
+		if (limits.infinite) depth = MAX_SEARCH_DEPTH;
+		depth = std::min(depth, MAX_SEARCH_DEPTH);
+
+		m_searchStart = std::chrono::steady_clock::now();
+		m_result.clear();
+
+		// Die Bewertung im Such-Thread verwendet die Zwischenspeicher der Engine, ihre Zhler laufen ber mehrere Suchen weiter
+		ChessEvaluation::bindCaches(m_evaluationCache.get(), m_pawnHashTable.get());
+		const auto& evaluation_cache = *m_evaluationCache;
+		const auto& pawn_hash_table = *m_pawnHashTable;
+		auto evaluation_cache_probes = evaluation_cache.getProbes(), evaluation_cache_hits = evaluation_cache.getHits();
+		auto pawn_hash_probes = pawn_hash_table.getProbes(), pawn_hash_hits = pawn_hash_table.getHits();
+
+		PAIR<Move, EVALUATION_VALUE> result = { INVALID_MOVE, 0 };
+
+		// Erffnungsbuch: Buchzug ohne Suche spielen (nicht im Analysemodus und nicht mit "searchmoves")
+		auto book_move = useOwnBook() && !limits.infinite && limits.searchMoves.empty() ? OpeningBook::probe(m_position) : INVALID_MOVE;
+
+		if (!book_move.isMoveInvalid())
+		{
+			m_startedDepth = 0;
+			result.first = book_move;
+			m_previousPv.clear();
+		}
 		// Wenn Tiefe = 0: einfach die Position direkt evaluieren
-		if (depth == 0)
+		else if (depth == 0)
 		{
-			m_result.insert(INVALID_MOVE, ChessEvaluation::evaluate(m_position, player, EVAL_FT_STANDARD, true), player == m_player);
+			m_startedDepth = 0;
+			result.second = ChessEvaluation::evaluate(m_position, player, m_evaluationFlags, true);
 		}
-		else minMax(m_position, m_player, depth, -INF, INF, parameterFlags);
+		else
+		{
+			MOVE_LIST moves = ChessValidation::getValidMoves(m_position, m_player);
+			sortMoves<FT_RUNTIME>(&moves, m_position, 0, parameterFlags);
+
+			// Wurzelzge ggf. auf "searchmoves" einschrnken (sofern darin legale Zge enthalten sind)
+			m_rootMoves.clear();
+			for (const auto& move : moves)
+			{
+				auto allowed = std::find_if(limits.searchMoves.begin(), limits.searchMoves.end(), [&move](const Move& search_move) {
+					return search_move == move 
+						&& (search_move.promotion == 0 || std::toupper(search_move.promotion) == std::toupper(move.promotion));
+				});
+
+				if (limits.searchMoves.empty() || allowed != limits.searchMoves.end()) m_rootMoves.emplace_back(move);
+			}
+			if (m_rootMoves.empty()) for (const auto& move : moves) m_rootMoves.emplace_back(move);
+
+			if (!m_previousPv.empty())
+			{
+				auto it = std::find_if(m_rootMoves.begin(), m_rootMoves.end(), [this](const RootMove& root_move) { return root_move.move == m_previousPv.front(); });
+				if (it != m_rootMoves.end()) std::rotate(m_rootMoves.begin(), it, it + 1);
+				else m_previousPv.clear();
+			}
+
+			multi_pv = std::min(multi_pv, static_cast<INT32>(m_rootMoves.size()));
+			ROOT_MOVE_LIST lines; // Hauptvarianten der letzten vollstndigen Iteration
+
+			// Iterative Vertiefung
+			for (auto iteration_depth = 1; iteration_depth <= depth && !m_rootMoves.empty(); iteration_depth++)
+			{
+				m_startedDepth = iteration_depth;
+
+				ROOT_MOVE_LIST iteration_lines;
+
+				// MultiPV: Je Hauptvariante die restlichen Wurzelzge ohne die bereits gefundenen Zge durchsuchen
+				for (auto pv_index = 0; pv_index < multi_pv; pv_index++)
+				{
+					m_result.clear();
+
+					// Standard-Bausteine ohne Abfragen der Features zur Laufzeit durchsuchen
+					auto value = parameterFlags == FT_STANDARD ?
+						searchRoot<FT_STANDARD>(pv_index, iteration_depth, parameterFlags) :
+						searchRoot<FT_RUNTIME>(pv_index, iteration_depth, parameterFlags);
+
+					// Abgebrochene Suche nur bernehmen, wenn noch kein Ergebnis vorliegt
+					if (m_stop && (!lines.empty() || !iteration_lines.empty())) break;
+
+					auto first = m_rootMoves.begin() + pv_index;
+					auto best = m_result.empty() ? PAIR<Move, EVALUATION_VALUE>{ first->move, value } : m_result.getResult();
+
+					// Gefundene Hauptvariante an die Position pv_index verschieben, damit sie in der nchsten Iteration zuerst untersucht wird
+					auto it = std::find_if(first, m_rootMoves.end(), [&best](const RootMove& root_move) { return root_move.move == best.first; });
+					it->score = best.second;
+					std::rotate(first, it, it + 1);
+
+					iteration_lines.push_back(*first);
+
+					if (m_stop) break;
+				}
+
+				// Abgebrochene Iteration verwerfen, sofern bereits eine vollstndige Iteration vorliegt
+				if (m_stop && !lines.empty()) break;
+
+				lines = std::move(iteration_lines);
+				result = { lines.front().move, lines.front().score };
+				m_previousPv = lines.front().pv;
+				m_statistics.iterationNodes.push_back(m_nodes);
+
+				// Nur vollstndige Iterationen melden
+				if (m_stop) break;
+
+				for (size_t pv_index = 0; pv_index < lines.size(); pv_index++)
+				{
+					SearchInfo info;
+					info.depth = iteration_depth;
+					info.selDepth = m_selDepth;
+					info.multiPv = static_cast<INT32>(pv_index) + 1;
+					info.score = lines[pv_index].score;
+					info.pv = lines[pv_index].pv;
+					reportSearchInfo(info);
+				}
+			}
+		}
+
 		auto time_end = std::chrono::steady_clock::now();
-		m_searchTime = (std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start).count());
+		m_searchTime = (std::chrono::duration_cast<std::chrono::microseconds>(time_end - m_searchStart).count());
 
 #if OWL_LOG_NO_INFO==false
 		std::cout << "info searchtime " << m_searchTime << " ms" << std::endl;
 #endif
+		// Analysemodus: Ergebnis erst nach dem Stop-Befehl zurckgeben
+		if (limits.infinite)
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_stopCondition.wait(lock, [this] { return m_stop.load(); });
+		}
+
+		m_statistics.evaluationCacheProbes = evaluation_cache.getProbes() - evaluation_cache_probes;
+		m_statistics.evaluationCacheHits = evaluation_cache.getHits() - evaluation_cache_hits;
+		m_statistics.pawnHashProbes = pawn_hash_table.getProbes() - pawn_hash_probes;
+		m_statistics.pawnHashHits = pawn_hash_table.getHits() - pawn_hash_hits;
+		ChessEvaluation::bindCaches(nullptr, nullptr);
+
 		m_mutex.lock();
+		m_lastStatistics = m_statistics;
 		m_ready = true;
 		m_stop = false;
-		auto result = m_result.getResult();
-		m_position.applyMove(result.first);
-		m_repitionMap.addPosition(m_position);
+		if (!result.first.isMoveInvalid())
+		{
+			m_position.applyMove(result.first);
+			m_repitionMap.addPosition(m_position);
+		}
 
 		m_mutex.unlock();
 
@@ -77,6 +229,15 @@ namespace owl
 		m_mutex.lock();
 		m_stop = true;
 		m_mutex.unlock();
+		m_stopCondition.notify_all();
+	}
+
+	VOID ChessEngine::prepareSearch()
+	{
+		m_mutex.lock();
+		m_stop = false;
+		m_ready = false;
+		m_mutex.unlock();
 	}
 
 	BOOL ChessEngine::isReady() const
@@ -89,6 +250,9 @@ namespace owl
 		if (m_engineOptions.isSupported(option)) {
 			m_engineOptions.setValue(option, value);
 		}
+
+		// Erffnungsbuch einblenden
+		if (option == "BookFile") OpeningBook::open(value);
 	}
 
 	const EngineOptions& ChessEngine::getOptions() const
@@ -112,16 +276,22 @@ namespace owl
 		return m_player;
 	}
 
-	INT32 ChessEngine::getPrunesCount() const
+	INT64 ChessEngine::getPrunesCount() const
 	{
 		return m_prunes;
 	}
 
-	INT32 ChessEngine::getNodesCount() const
+	INT64 ChessEngine::getNodesCount() const
 	{
 		return m_nodes;
 	}
 
+	SearchStatistics ChessEngine::getStatistics()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_lastStatistics;
+	}
+
 	INT64 ChessEngine::getSearchTime() const
 	{
 		return m_searchTime;
@@ -132,19 +302,214 @@ namespace owl
 		return m_position;
 	}
 
-	EVALUATION_VALUE ChessEngine::minMax(Position& position, INT32 player, INT32 depth, FLOAT alpha, FLOAT beta, UCHAR parameterFlags)
-	{		
+	VOID ChessEngine::newGame()
+	{
+		m_mutex.lock();
+		m_position = ChessUtility::fenToPosition(STARTPOS_FEN);
+		m_repitionMap.clear();
+		m_previousPv.clear();
+		m_evaluationCache->clear();
+		m_pawnHashTable->clear();
+		m_mutex.unlock();
+	}
+
+	VOID ChessEngine::clearEvaluationCache()
+	{
+		m_mutex.lock();
+		m_evaluationCache->clear();
+		m_mutex.unlock();
+	}
+
+	VOID ChessEngine::setSearchInfoCallback(const SEARCH_INFO_CALLBACK& callback)
+	{
+		m_mutex.lock();
+		m_searchInfoCallback = callback;
+		m_mutex.unlock();
+	}
+
+	VOID ChessEngine::setEvaluationFeatures(UCHAR evaluationFeatureFlags)
+	{
+		m_evaluationFlags = evaluationFeatureFlags;
+	}
+
+	template <INT32 Flags>
+	EVALUATION_VALUE ChessEngine::searchRoot(size_t first, INT32 depth, UCHAR parameterFlags)
+	{
+		const auto features = FEATURE_FLAGS<Flags>(parameterFlags);
+
+		EVALUATION_VALUE value = -INF;
+		EVALUATION_VALUE beta = INF;
+
+		m_statistics.nodesByPly[0]++;
+
+		for (auto index = first; index < m_rootMoves.size(); index++)
+		{
+			if (m_stop) break;
+
+			auto& root_move = m_rootMoves[index];
+
+			// Aktuellen Wurzelzug melden (gedrosselt, erst nach CURRMOVE_REPORT_DELAY)
+			auto elapsed = getElapsedTime();
+			if (elapsed >= CURRMOVE_REPORT_DELAY && elapsed - m_lastCurrMoveReport >= CURRMOVE_REPORT_INTERVAL)
+			{
+				m_lastCurrMoveReport = elapsed;
+
+				SearchInfo info;
+				info.type = SearchInfo::Type::CurrMove;
+				info.depth = depth;
+				info.currMove = root_move.move;
+				info.currMoveNumber = static_cast<INT32>(index) + 1;
+				reportSearchInfo(info);
+			}
+
+			auto nodes = m_nodes.load(std::memory_order_relaxed);
+
+			// Nur die erste Hauptvariante folgt der Hauptvariante der letzten Iteration
+			m_followPv = first == 0 && index == 0 && !m_previousPv.empty() && m_previousPv.front() == root_move.move;
+
+			m_position.applyMove(root_move.move);
+			EVALUATION_VALUE new_value = minMax<Flags>(m_position, -m_player, depth - 1, value, beta, parameterFlags);
+			m_position.undoLastMove();
+
+			m_followPv = false;
+			root_move.nodes += m_nodes - nodes;
+
+			// Wert eines abgebrochenen Teilbaums nicht bernehmen
+			if (m_stop) break;
+
+			root_move.score = new_value;
+			root_move.pv = { root_move.move };
+
+			if (new_value > value - RANDOM_THRESHOLD)
+			{
+				if (new_value > value)
+				{
+					value = new_value;
+					root_move.pv.insert(root_move.pv.end(), m_pvTable[1].begin(), m_pvTable[1].begin() + m_pvLength[1]);
+				}
+				m_result.insert(root_move.move, new_value, true);
+
+				if (features & FT_ALPHA_BETA && value - RANDOM_THRESHOLD >= beta)
+				{
+					insertKiller(root_move.move, 0);
+					m_prunes.fetch_add(1, std::memory_order_relaxed);
+					m_statistics.addCutoff(index == first);
+					break;
+				}
+			}
+		}
+
+		return value;
+	}
+
+	VOID ChessEngine::reportSearchInfo(SearchInfo& info)
+	{
+		if (!m_searchInfoCallback) return;
+
+		auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_searchStart).count();
+
+		info.time = elapsed_us / 1000;
+		info.nodes = m_nodes;
+		info.nps = elapsed_us > 0 ? info.nodes * 1000000 / elapsed_us : 0;
+
+		m_searchInfoCallback(info);
+	}
+
+	BOOL ChessEngine::useOwnBook() const
+	{
+		return m_engineOptions.getValue("OwnBook") == "true" && OpeningBook::isOpen();
+	}
+
+	INT32 ChessEngine::getMultiPV() const
+	{
+		const auto& option = m_engineOptions.getOption("MultiPV");
+		const auto& value = option.value.empty() ? option.default_value : option.value;
+
+		INT32 multi_pv = 1;
+		try
+		{
+			multi_pv = std::stoi(value);
+		}
+		catch (const std::exception&)
+		{
+		}
+
+		return std::max(multi_pv, 1);
+	}
+
+	VOID ChessEngine::updatePv(INT32 ply, const Move& move)
+	{
+		auto& line = m_pvTable[ply];
+		const auto& child_line = m_pvTable[ply + 1];
+
+		line[0] = move;
+		std::copy(child_line.begin(), child_line.begin() + m_pvLength[ply + 1], line.begin() + 1);
+		m_pvLength[ply] = m_pvLength[ply + 1] + 1;
+	}
+
+	VOID ChessEngine::checkLimits()
+	{
+		if (m_limits.infinite) return;
+
+		if ((m_limits.moveTime > 0 && getElapsedTime() >= m_limits.moveTime)
+			|| (m_limits.nodes > 0 && m_nodes.load(std::memory_order_relaxed) >= m_limits.nodes))
+		{
+			m_stop = true;
+		}
+	}
+
+	INT64 ChessEngine::getElapsedTime() const
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_searchStart).count();
+	}
+
+	template <INT32 Flags>
+	EVALUATION_VALUE ChessEngine::minMax(Position& position, INT32 player, INT32 depth, EVALUATION_VALUE alpha, EVALUATION_VALUE beta, UCHAR parameterFlags)
+	{
+		// Fr feste Flags ist features eine Konstante und alle Abfragen der Bausteine entfallen
+		const auto features = FEATURE_FLAGS<Flags>(parameterFlags);
+
 		if (m_stop)
 		{
 			return -INF;
 		}
 
-		m_nodes++;
+		// Zeit- und Knotengrenzen nur in festen Abstnden prfen
+		if ((m_nodes.fetch_add(1, std::memory_order_relaxed) & (SEARCH_POLL_INTERVAL - 1)) == 0) checkLimits();
+
+		auto ply = m_startedDepth - depth; // Halbzug ab der Wurzel
+		if (ply > m_selDepth) m_selDepth = ply;
+		m_pvLength[ply] = 0;
+		m_statistics.nodesByPly[ply]++;
+
+		// Remis durch Stellungswiederholung?
+		if (position.isRepetition()) return DRAW_VALUE;
+
+		// Remis durch 50-Zge-Regel? (Ein Matt im letzten Halbzug hat Vorrang)
+		if (position.getPlyCount() >= MAX_PLIES_SINCE_NO_MOVING_PAWNS_AND_CAPTURES)
+		{
+			if (!ChessValidation::isKingInCheck(position, player) || ChessValidation::hasLegalMove(position, player)) return DRAW_VALUE;
+		}
 
 		// Blattknoten erreicht?
 		if (depth == 0)
 		{
-			return ChessEvaluation::evaluate(position, m_player, EVAL_FT_STANDARD, true);
+			// Mit Alpha-Beta gengt auerhalb des Fensters eine Schranke (Lazy Evaluation)
+			EVALUATION_VALUE value;
+			if (m_evaluationFlags == EVAL_FT_STANDARD)
+			{
+				value = features & FT_ALPHA_BETA ?
+					ChessEvaluation::evaluate<EVAL_FT_STANDARD>(position, m_player, alpha, beta, true) :
+					ChessEvaluation::evaluate<EVAL_FT_STANDARD>(position, m_player, true);
+			}
+			// Andere Bewertungs-Features (Ablationsstudien) zur Laufzeit auswerten, ebenfalls mit Lazy Evaluation
+			else
+			{
+				value = features & FT_ALPHA_BETA ?
+					ChessEvaluation::evaluate(position, m_player, m_evaluationFlags, alpha, beta, true) :
+					ChessEvaluation::evaluate(position, m_player, m_evaluationFlags, true);
+			}
+			return MATE_SCORE_AT_PLY(value, ply);
 		} 
 
 		// Liste generieren + Checkmate berprfen bei 0 Zgen
@@ -153,11 +518,26 @@ namespace owl
 		// Endstellung erreicht? 
 		if (moves.empty())
 		{
-			return ChessEvaluation::evaluate(position, m_player, EVAL_FT_STANDARD, false);
+			return MATE_SCORE_AT_PLY(ChessEvaluation::evaluate(position, m_player, m_evaluationFlags, false), ply);
 		}
 
 		// Zge gegebenfalls sortieren
-		sortMoves(&moves, position, depth, parameterFlags);
+		sortMoves<Flags>(&moves, position, ply, parameterFlags);
+
+		// Hauptvariante der letzten Iteration zuerst untersuchen
+		if (m_followPv)
+		{
+			m_followPv = false;
+			if (ply < static_cast<INT32>(m_previousPv.size()))
+			{
+				auto it = std::find(moves.begin(), moves.end(), m_previousPv[ply]);
+				if (it != moves.end())
+				{
+					std::rotate(moves.begin(), it, it + 1);
+					m_followPv = true;
+				}
+			}
+		}
 		
 		EVALUATION_VALUE value = player == m_player ? alpha : beta;
 
@@ -165,104 +545,46 @@ namespace owl
 		{
 			position.applyMove(move);
 
-			FLOAT new_alpha = player == m_player ? static_cast<FLOAT>(value) : alpha;
-			FLOAT new_beta = player == m_player ? beta : static_cast<FLOAT>(value);
+			EVALUATION_VALUE new_alpha = player == m_player ? value : alpha;
+			EVALUATION_VALUE new_beta = player == m_player ? beta : value;
 
-			EVALUATION_VALUE new_value = minMax(position, -player, depth - 1, new_alpha, new_beta, parameterFlags);
+			EVALUATION_VALUE new_value = minMax<Flags>(position, -player, depth - 1, new_alpha, new_beta, parameterFlags);
+			m_followPv = false;
 
 			position.undoLastMove();
 
-			if (player == m_player && new_value > static_cast<FLOAT>(value)-RANDOM_THRESHOLD)
+			// Abgebrochene Suche: restliche Zge nicht mehr untersuchen
+			if (m_stop) break;
+
+			if (player == m_player && new_value > value-RANDOM_THRESHOLD)
 			{
-            #if OWL_LOG_MOVE_STACK==true
-                if (depth == 1)
-                {
-                    std::cout << "info update old_value: {" << value << "} value: {" << new_value << "}\n";
-                    position.applyMove(move);
-                    std::stack<Position::MoveData> _mvs = position.getMoveDataStack();
-                    std::vector<Position::MoveData> _vmvs;
-                    
-                    while(_mvs.size() > 1)
-                    {
-                        _vmvs.insert(_vmvs.begin(), _mvs.top());
-                        _mvs.pop();
-                    }
-                    
-                    std::cout << "info update fen " << ChessUtility::positionToFen(position) << "\n";
-                    
-                    std::cout << "info update moves ";
-                    for(auto& item : _vmvs)
-                    {
-                        std::cout << ChessUtility::moveToString(item.move) << " ";
-                    }
-                    std::cout << "\n\n";
-                    position.undoLastMove();
-                }
-            #endif
-
-				if (new_value > value) value = new_value;
-                
-				if (depth == m_startedDepth) {
-					m_result.insert(move, new_value, true);
-
-					if (parameterFlags & FT_ALPHA_BETA && static_cast<FLOAT>(value) - RANDOM_THRESHOLD >= beta)
-					{
-						insertKiller(move, depth);
-						m_prunes++;
-						break;
-					}
+				if (new_value > value)
+				{
+					value = new_value;
+					updatePv(ply, move);
 				}
-				else if (parameterFlags & FT_ALPHA_BETA && static_cast<FLOAT>(value) >= beta)
+                
+				if (features & FT_ALPHA_BETA && value >= beta)
 				{
-					insertKiller(move, depth);
-					m_prunes++;
+					insertKiller(move, ply);
+					m_prunes.fetch_add(1, std::memory_order_relaxed);
+					m_statistics.addCutoff(&move == &moves.front());
 					break;
 				}
 			}
-			else if (player != m_player && new_value < static_cast<FLOAT>(value)+RANDOM_THRESHOLD)
+			else if (player != m_player && new_value < value+RANDOM_THRESHOLD)
 			{
-            #if OWL_LOG_MOVE_STACK==true
-                if (depth == 1)
-                {
-                    std::cout << "info update old_value: {" << value << "} value: {" << new_value << "}\n";
-                    position.applyMove(move);
-                    std::stack<Position::MoveData> _mvs = position.getMoveDataStack();
-                    std::vector<Position::MoveData> _vmvs;
-                    
-                    while(_mvs.size() > 1)
-                    {
-                        _vmvs.insert(_vmvs.begin(), _mvs.top());
-                        _mvs.pop();
-                    }
-                    
-                    std::cout << "info update fen " << ChessUtility::positionToFen(position) << "\n";
-                    
-                    std::cout << "info update moves ";
-                    for(auto& item : _vmvs)
-                    {
-                        std::cout << ChessUtility::moveToString(item.move) << " ";
-                    }
-                    std::cout << "\n\n";
-                    position.undoLastMove();
-                    
-                }
-            #endif
-				if (new_value < value) value = new_value;
-                
-				if (depth == m_startedDepth) {
-					m_result.insert(move, new_value, false);
-
-					if (parameterFlags & FT_ALPHA_BETA && static_cast<FLOAT>(value) + RANDOM_THRESHOLD <= alpha)
-					{
-						insertKiller(move, depth);
-						m_prunes++;
-						break;
-					}
+				if (new_value < value)
+				{
+					value = new_value;
+					updatePv(ply, move);
 				}
-				else if (parameterFlags & FT_ALPHA_BETA && static_cast<FLOAT>(value) <= alpha)
+                
+				if (features & FT_ALPHA_BETA && value <= alpha)
 				{
-					insertKiller(move, depth);
-					m_prunes++;
+					insertKiller(move, ply);
+					m_prunes.fetch_add(1, std::memory_order_relaxed);
+					m_statistics.addCutoff(&move == &moves.front());
 					break;
 				}
 			}
@@ -271,53 +593,81 @@ namespace owl
 		return value;
 	}
 
-	VOID ChessEngine::sortMoves(MOVE_LIST* moves, Position& position, INT32 depth, UCHAR parameterFlags)
+	template <INT32 Flags>
+	VOID ChessEngine::sortMoves(MOVE_LIST* moves, Position& position, INT32 ply, UCHAR parameterFlags)
 	{
+		const auto features = FEATURE_FLAGS<Flags>(parameterFlags);
+
 		// Falls keine Sortierung aktiviert wurde: nichts tun
-		if (parameterFlags < FT_BIT_SORT_BEGIN ) return;
+		if (features < FT_BIT_SORT_BEGIN ) return;
 
 		auto& enginePlayer = m_player;
 
-		std::sort(moves->begin(), moves->end(), [this, &position, depth, parameterFlags, &enginePlayer](const Move& left, const Move& right)
+		// Schlagzge einmalig vorab bewerten (SEE und MVV-LVA), statt bei jedem Vergleich
+		struct OrderedMove
+		{
+			Move move;
+			INT32 category = ORDER_QUIET;	// Schlagzug mit Gewinn, ruhiger Zug oder Schlagzug mit Verlust
+			EVALUATION_VALUE see = 0;		// Materialbilanz der Schlagabfolge (Static Exchange Evaluation)
+			INT32 mvvLva = 0;				// Wertvollstes Opfer, geringwertigster Angreifer
+		};
+
+		std::vector<OrderedMove> ordered(moves->size());
+		for (size_t i = 0; i < moves->size(); i++)
+		{
+			auto& entry = ordered[i];
+			entry.move = (*moves)[i];
+
+			if (features & FT_SRT_MVV_LVA && entry.move.capture)
+			{
+				const auto& move = entry.move;
+				auto attacker = GET_PIECE_INDEX_BY_TYPE(position[move.startY][move.startX]);
+				auto victim = move.enPassantCapture ? PAWN_INDEX : GET_PIECE_INDEX_BY_TYPE(position[move.targetY][move.targetX]);
+
+				entry.see = ChessEvaluation::staticExchangeEvaluation(position, move);
+				entry.category = entry.see >= 0 ? ORDER_GOOD_CAPTURE : ORDER_BAD_CAPTURE;
+				entry.mvvLva = victim * MAX_PIECE_TYPES + (LAST_PIECE_TYPES_INDEX - attacker);
+			}
+		}
+
+		std::sort(ordered.begin(), ordered.end(), [this, &position, ply, features, &enginePlayer](const OrderedMove& orderedLeft, const OrderedMove& orderedRight)
 		{
-			// MVV_LVA: 
-			if (parameterFlags & FT_SRT_MVV_LVA)
+			const auto& left = orderedLeft.move;
+			const auto& right = orderedRight.move;
+
+			// MVV_LVA mit SEE: Gewinnende und ausgeglichene Schlagzge zuerst, verlierende nach Killern und ruhigen Zgen
+			if (features & FT_SRT_MVV_LVA)
 			{
-				if (left.capture && !right.capture) return CHOOSE_LEFT;
-				if (right.capture && !left.capture) return CHOOSE_RIGHT;
+				if (orderedLeft.category != orderedRight.category) return orderedLeft.category < orderedRight.category;
 
-				if (left.capture && right.capture)
+				if (orderedLeft.category != ORDER_QUIET)
 				{
-					return getCaptureValue(position[left.startY][left.startX], position[left.targetY][left.targetX]) 
-					> getCaptureValue(position[right.startY][right.startX], position[right.targetY][right.targetX]);
+					if (orderedLeft.see != orderedRight.see) return orderedLeft.see > orderedRight.see;
+					return orderedLeft.mvvLva > orderedRight.mvvLva;
 				}
 			}
 
 			// Killer-Heuristik:
-			if (parameterFlags & FT_SRT_KILLER)
+			if (features & FT_SRT_KILLER)
 			{
-				// Linke Seite mit Killer vergleichen
-				auto left_prio = compareKiller(left, depth);
-				if (left_prio == KILLER_PRIO_1) return CHOOSE_LEFT;
+				// Beide Seiten mit Killer vergleichen
+				auto left_prio = compareKiller(left, ply);
+				auto right_prio = compareKiller(right, ply);
 
-				// Rechte Seite mit Killer vergleichen
-				auto right_prio = compareKiller(right, depth);
-				if (right_prio == KILLER_PRIO_1) return CHOOSE_RIGHT;
-
-				// Falls einer der beiden Seiten ein Killerzug sind vergleichen
-				if (left_prio > KILLER_NO_PRIO || right_prio > KILLER_NO_PRIO)
-					return left_prio > right_prio;
+				// Hhere Prioritt zuerst. Gleiche Prioritt (z.B. Umwandlungen in verschiedene Figuren mit gleichem Start- und Zielfeld)
+				// darf nicht fr beide Seiten CHOOSE_LEFT ergeben, sonst ist die Ordnung fr std::sort ungltig
+				if (left_prio != right_prio) return left_prio > right_prio;
 				// Ansonsten fortfahren
 			}
 
 			// Material-Heuristik
-			if (parameterFlags & FT_SRT_MATERIAL)
+			if (features & FT_SRT_MATERIAL)
 			{
 				position.applyMove(left);
-				FLOAT left_move_value = ChessEvaluation::evaluate(position, enginePlayer, 0);
+				EVALUATION_VALUE left_move_value = ChessEvaluation::evaluate<EVAL_FT_NULL>(position, enginePlayer);
 				position.undoLastMove();
 				position.applyMove(right);
-				FLOAT right_move_value = ChessEvaluation::evaluate(position, enginePlayer, 0);
+				EVALUATION_VALUE right_move_value = ChessEvaluation::evaluate<EVAL_FT_NULL>(position, enginePlayer);
 				position.undoLastMove();
 
 				return left_move_value > right_move_value;
@@ -326,6 +676,8 @@ namespace owl
 			// Unterdrckung der Warnung: Wenn alles klappt, wird 'return true' gar nicht erst erreicht
 			return false; 
 		});
+
+		for (size_t i = 0; i < moves->size(); i++) (*moves)[i] = ordered[i].move;
 	}
 
 	VOID ChessEngine::insertKiller(const Move move, const INT32 ply)
@@ -345,8 +697,8 @@ namespace owl
 
 	INT32 ChessEngine::compareKiller(const Move move, const INT32 ply)
 	{
-		// Wurzelknoten?
-		if (ply >= MAX_DEPTH) return KILLER_NO_PRIO;
+		// Auerhalb der Killer-Liste?
+		if (ply >= MAX_SEARCH_DEPTH) return KILLER_NO_PRIO;
 
 		// Noch keiner Killer vorhanden?
 		if (m_killerList[FIRST_KILLER_INDEX][ply].isMoveInvalid()) return KILLER_NO_PRIO;
@@ -361,70 +713,11 @@ namespace owl
 		return KILLER_NO_PRIO;
 	}
 
-	Captures ChessEngine::getCaptureValue(CHAR attacker, CHAR victim)
-	{
-		attacker = std::tolower(attacker);
-		victim = std::toupper(victim);
-
-		switch (victim)
-		{
-		case WHITE_PAWN:
-			switch (attacker)
-			{
-			case BLACK_PAWN: return Captures::pxP; break;
-			case BLACK_KNIGHT: return Captures::nxP; break;
-			case BLACK_BISHOP: return Captures::bxP; break;
-			case BLACK_ROOK: return Captures::rxP; break;
-			case BLACK_QUEEN: return Captures::qxP; break;
-			case BLACK_KING: return Captures::kxP; break;
-			}
-			break;
-		case WHITE_KNIGHT:
-			switch (attacker)
-			{
-			case BLACK_PAWN: return Captures::pxN; break;
-			case BLACK_KNIGHT: return Captures::nxN; break;
-			case BLACK_BISHOP: return Captures::bxN; break;
-			case BLACK_ROOK: return Captures::rxN; break;
-			case BLACK_QUEEN: return Captures::qxN; break;
-			case BLACK_KING: return Captures::kxN; break;
-			}
-			break;
-		case WHITE_BISHOP:
-			switch (attacker)
-			{
-			case BLACK_PAWN: return Captures::pxB; break;
-			case BLACK_KNIGHT: return Captures::nxB; break;
-			case BLACK_BISHOP: return Captures::bxB; break;
-			case BLACK_ROOK: return Captures::rxB; break;
-			case BLACK_QUEEN: return Captures::qxB; break;
-			case BLACK_KING: return Captures::kxB; break;
-			}
-			break;
-		case WHITE_ROOK:
-			switch (attacker)
-			{
-			case BLACK_PAWN: return Captures::pxR; break;
-			case BLACK_KNIGHT: return Captures::nxR; break;
-			case BLACK_BISHOP: return Captures::bxR; break;
-			case BLACK_ROOK: return Captures::rxR; break;
-			case BLACK_QUEEN: return Captures::qxR; break;
-			case BLACK_KING: return Captures::kxR; break;
-			}
-			break;
-		case WHITE_QUEEN:
-			switch (attacker)
-			{
-			case BLACK_PAWN: return Captures::pxQ; break;
-			case BLACK_KNIGHT: return Captures::nxQ; break;
-			case BLACK_BISHOP: return Captures::bxQ; break;
-			case BLACK_ROOK: return Captures::rxQ; break;
-			case BLACK_QUEEN: return Captures::qxQ; break;
-			case BLACK_KING: return Captures::kxQ; break;
-			}
-			break;
-		}
-
-		return Captures::kxP;
-	}
+	// Explizite Instanziierungen: Standard-Bausteine und Auswertung der Bausteine zur Laufzeit
+	template EVALUATION_VALUE ChessEngine::searchRoot<FT_STANDARD>(size_t first, INT32 depth, UCHAR parameterFlags);
+	template EVALUATION_VALUE ChessEngine::searchRoot<FT_RUNTIME>(size_t first, INT32 depth, UCHAR parameterFlags);
+	template EVALUATION_VALUE ChessEngine::minMax<FT_STANDARD>(Position& position, INT32 player, INT32 depth, EVALUATION_VALUE alpha, EVALUATION_VALUE beta, UCHAR parameterFlags);
+	template EVALUATION_VALUE ChessEngine::minMax<FT_RUNTIME>(Position& position, INT32 player, INT32 depth, EVALUATION_VALUE alpha, EVALUATION_VALUE beta, UCHAR parameterFlags);
+	template VOID ChessEngine::sortMoves<FT_STANDARD>(MOVE_LIST* moves, Position& position, INT32 ply, UCHAR parameterFlags);
+	template VOID ChessEngine::sortMoves<FT_RUNTIME>(MOVE_LIST* moves, Position& position, INT32 ply, UCHAR parameterFlags);
 }
@@ -9,8 +9,17 @@
 #include "ChessValidation.hpp"
 #include "RepitionMap.hpp"
 #include "EngineOptions.hpp"
+#include "SearchInfo.hpp"
+#include "RootMove.hpp"
+#include "SearchStatistics.hpp"
+#include "EvaluationCache.hpp"
+#include "PawnHashTable.hpp"
 
+#include <memory>
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 
 namespace owl
 {
@@ -24,14 +33,23 @@ namespace owl
 		virtual ~ChessEngine();
 		/**
 		 * Funktion zur Ermittlung des Zugs der aktuellen Position.
-		 * Wird von der UCI-Schnittstelle ermittelt
+		 * Wird von der UCI-Schnittstelle ermittelt.
+		 * Die Suche vertieft iterativ von Tiefe 1 bis depth und meldet nach jeder Iteration den Stand ber die Rckruffunktion.
+		 * Mit der Engine-Option "MultiPV" werden je Iteration die besten K Wurzelzge mit exakter Bewertung ermittelt und gemeldet.
 		 * 
 		 * \param player der Spieler Wei/Schwarz der Schach-Engine (1 oder -1)
 		 * \param depth die maximale Suchtiefe fr die Zugfindung
 		 * \param parameter_flags Baustein-Parameter (>= FT_NULL)
+		 * \param limits Weitere Grenzen der Suche (Analysemodus, Zeit, Knoten, Wurzelzge)
 		 * \return Den besten Zug und sein korrespondierenden Wert aus der Evaluierung
 		 */
-		PAIR<Move, EVALUATION_VALUE> searchMove(INT32 player, INT32 depth, UCHAR parameter_flags);
+		PAIR<Move, EVALUATION_VALUE> searchMove(INT32 player, INT32 depth, UCHAR parameter_flags, 
+			const SearchLimits& limits = SearchLimits());
+		/**
+		 * Bereite eine Suche vor, die anschlieend in einem eigenen Thread gestartet wird.
+		 * Setzt das Stop-Signal zurck und markiert die Engine als beschftigt, damit ein unmittelbar folgendes stop() nicht verloren geht.
+		 */
+		VOID prepareSearch();
 		/**
 		 * berprfung, ob der Debug-Modus fr das UCI aktiviert ist.
 		 * 
@@ -47,6 +65,7 @@ namespace owl
 		/**
 		 * Stoppe die aktuelle Berechnung. 
 		 * Dieser Befehl wird durch das UCI gegebenfalls ausgelst um die Berechnung der Engine abzubrechen.
+		 * Die Suche prft das Signal in jedem Knoten und kehrt daher innerhalb weniger Millisekunden zurck.
 		 * 
 		 */
 		VOID stop();
@@ -82,6 +101,14 @@ namespace owl
 		 */
 		Position& getPosition();
 		const Position& getPosition() const;
+		/**
+		 * Neue Partie beginnen: Startstellung setzen und Partie-Informationen (Stellungswiederholung, Hauptvariante, Zwischenspeicher der Bewertung) zurcksetzen.
+		 */
+		VOID newGame();
+		/**
+		 * Zwischenspeicher der Bewertungsfunktion leeren (z.B. nach dem Neuerzeugen der Bitbasen).
+		 */
+		VOID clearEvaluationCache();
 		/**
 		 * Gebe den aktuellen Spieler der Engine zurck.
 		 * 
@@ -94,87 +121,170 @@ namespace owl
 		 * 
 		 * \return Anzahl der Prunings
 		 */
-		INT32 getPrunesCount() const;
+		INT64 getPrunesCount() const;
 		/**
 		 * Die Anzahl der durchsuchten Knoten der letzten Suche.
 		 * Wird mit jeder Suche auf 0 zurck gesetzt.
 		 * 
 		 * \return Anzahl der besuchten Knoten
 		 */
-		INT32 getNodesCount() const;
+		INT64 getNodesCount() const;
+		/**
+		 * Die Statistik der letzten abgeschlossenen Suche (Knoten je Halbzug, Beta-Schnitte, Zwischenspeicher, Verzweigungsfaktor).
+		 * 
+		 * \return Statistik der letzten Suche
+		 */
+		SearchStatistics getStatistics();
 		/**
 		 * Die bentigte Zeit in Mikrosekunden, die die Zugfindung fr die letzte Suche bentigt hat.
 		 * 
 		 * \return Bentigte Zeit in Mikrosekunden
 		 */
 		INT64 getSearchTime() const;
+		/**
+		 * Setze die Rckruffunktion, die whrend der Suche mit Suchinformationen (Iterationen, aktueller Wurzelzug) aufgerufen wird.
+		 * Die Funktion wird im Such-Thread aufgerufen und sollte daher nicht blockieren.
+		 * 
+		 * \param callback Rckruffunktion
+		 */
+		VOID setSearchInfoCallback(const SEARCH_INFO_CALLBACK& callback);
+		/**
+		 * Setze die Feature-Parameter der Bewertungsfunktion fr die Suche (z.B. fr Ablationsstudien).
+		 * Fr EVAL_FT_STANDARD wird die spezialisierte Bewertung verwendet, andere Kombinationen werden zur Laufzeit ausgewertet.
+		 * Die Lazy Evaluation ist in beiden Fllen aktiv, damit sich Vergleiche nur im abgeschalteten Feature unterscheiden.
+		 * 
+		 * \param evaluationFeatureFlags Feature-Parameter-Flags, die mit EVAL_FT_* beginnen
+		 */
+		VOID setEvaluationFeatures(UCHAR evaluationFeatureFlags);
 	private:
 		/**
 		 * Der Min-Max-Algorithmus samt seiner Bausteine fr die Zugfindung zu einer Stellung.
+		 * Explizit instanziiert fr FT_STANDARD und FT_RUNTIME (alle anderen Kombinationen, z.B. Ablationsstudien).
 		 * 
+		 * \tparam Flags Die Bausteine zur Kompilierzeit (FT_*) oder FT_RUNTIME
 		 * \param position Die zu untersuchende Ausgangsstellung
 		 * \param player Der Spieler, der in der Iteration am Zug ist (1 oder -1)
 		 * \param depth Die aktuelle Tiefe (0 <= d <= m_startedDepth)
 		 * \param alpha Die Alpha-Grenze fr die Alpha-Beta-Suche
 		 * \param beta Die Beta-Grenze fr die Alpha-Beta-Suche
-		 * \param parameterFlags Die Parameter zur Aktivierung der Bausteine die mit FT_* beginnen
+		 * \param parameterFlags Die Parameter zur Aktivierung der Bausteine die mit FT_* beginnen (nur fr FT_RUNTIME verwendet)
 		 * \return der aktuelle evaluierte Wert aus einer Iteration des Min-Max-Algorithmus
 		 */
+		template <INT32 Flags>
 		EVALUATION_VALUE minMax(Position& position, INT32 player,
-			INT32 depth, FLOAT alpha, FLOAT beta, 
+			INT32 depth, EVALUATION_VALUE alpha, EVALUATION_VALUE beta, 
 			UCHAR parameterFlags);
+		/**
+		 * Eine Iteration der Suche an der Wurzel ber m_rootMoves ab dem Index first.
+		 * Die Ergebnisse werden in m_result gespeichert, Bewertung und Knotenanzahl zustzlich je Wurzelzug.
+		 * 
+		 * \tparam Flags Die Bausteine zur Kompilierzeit (FT_*) oder FT_RUNTIME
+		 * \param first Index des ersten zu durchsuchenden Wurzelzugs (vorherige Zge sind bereits Hauptvarianten)
+		 * \param depth Die Suchtiefe der Iteration
+		 * \param parameterFlags Die Parameter zur Aktivierung der Bausteine die mit FT_* beginnen (nur fr FT_RUNTIME verwendet)
+		 * \return Der beste Wert der Iteration
+		 */
+		template <INT32 Flags>
+		EVALUATION_VALUE searchRoot(size_t first, INT32 depth, UCHAR parameterFlags);
+		/**
+		 * Melde eine Suchinformation an die Rckruffunktion, sofern diese gesetzt wurde.
+		 * 
+		 * \param info Suchinformation (Zeit, Knoten und NPS werden ergnzt)
+		 */
+		VOID reportSearchInfo(SearchInfo& info);
+		/**
+		 * Bisherige Suchzeit der aktuellen Suche.
+		 * 
+		 * \return Suchzeit in ms
+		 */
+		INT64 getElapsedTime() const;
+		/**
+		 * Anzahl der zu ermittelnden Hauptvarianten aus der Engine-Option "MultiPV".
+		 * 
+		 * \return Anzahl der Hauptvarianten (>= 1)
+		 */
+		INT32 getMultiPV() const;
+		/**
+		 * Soll das Erffnungsbuch verwendet werden? (Engine-Option "OwnBook" und ein geffnetes Buch aus "BookFile")
+		 * 
+		 * \return Zutreffend?
+		 */
+		BOOL useOwnBook() const;
+		/**
+		 * berprfe die Zeit- und Knotengrenzen der Suche und setze bei berschreitung das Stop-Signal.
+		 * Wird alle SEARCH_POLL_INTERVAL Knoten aufgerufen.
+		 */
+		VOID checkLimits();
+		/**
+		 * Aktualisiere die Hauptvariante des Halbzugs in der triangularen PV-Tabelle:
+		 * Der Zug wird vor die Hauptvariante des nachfolgenden Halbzugs gesetzt.
+		 * 
+		 * \param ply Halbzug ab der Wurzel
+		 * \param move Neuer bester Zug des Halbzugs
+		 */
+		VOID updatePv(INT32 ply, const Move& move);
 		/**
 		 * Funktion zur Sortierung der legalen Zge innerhalb der Iteration.
 		 * 
+		 * \tparam Flags Die Bausteine zur Kompilierzeit (FT_*) oder FT_RUNTIME
 		 * \param moves Der Zeiger auf die Liste der Zge, die sortiert werden soll
 		 * \param position Die aktuelle Position
-		 * \param depth Die momentane Tiefe der Iteration fr den Vergleich der Killerzge (Killer-Heuristik)
-		 * \param parameterFlags Bausteine mit FT_SRT_*, die fr die Sortierung aktiviert werden sollen
+		 * \param ply Der Halbzug ab der Wurzel fr den Vergleich der Killerzge (Killer-Heuristik)
+		 * \param parameterFlags Bausteine mit FT_SRT_*, die fr die Sortierung aktiviert werden sollen (nur fr FT_RUNTIME verwendet)
 		 */
-		VOID sortMoves(MOVE_LIST* moves, Position& position, INT32 depth, 
+		template <INT32 Flags>
+		VOID sortMoves(MOVE_LIST* moves, Position& position, INT32 ply, 
 			UCHAR parameterFlags);
 		/**
 		 * Der Versuch des Hinzufgens eines neuen Killerzugs.
 		 * Die berprfung, ob der Zug einer Killerzug ist, wird in der Funktion ausgefhrt.
 		 * \param move Der neue Zug, der in Frage kommt
-		 * \param ply die aktuelle Suchtiefe aus der Iteration des Min-Max-Algorithmus
+		 * \param ply der aktuelle Halbzug ab der Wurzel aus der Iteration des Min-Max-Algorithmus
 		 */
 		VOID insertKiller(const Move move, const INT32 ply);
 		/**
 		 * Funktion die einen Zug auf Killer-Zug berprft und eine Prioritt zurckliefert.
 		 * 
 		 * \param move Der Zug, der mit den Killerzgen verglichen werden soll.
-		 * \param ply Die Suchtiefe, in der nach den Killerzgen verglichen werden soll.
+		 * \param ply Der Halbzug ab der Wurzel, in dem nach den Killerzgen verglichen werden soll.
 		 * \return Der Priorittswert: KILLER_NO_PRIO = 0, KILLER_PRIO_2 = 1, KILLER_PRIO_1 = 2
 		 */
 		INT32 compareKiller(const Move move, const INT32 ply);
 
-		/**
-		 * Berechne den Wert nach MVV-LVA der Figuren zwischen Angreifer und Opfer.
-		 * 
-		 * \param attacker Angreifer-Figur
-		 * \param victim Geschlagene Figur (Opfer)
-		 * \return Korrespondierende Wert 
-		 */
-		static Captures getCaptureValue(CHAR attacker, CHAR victim);
-
 		KILLER_LIST m_killerList;		// Killerzge
 		Position m_position;			// Aktuelle Position der Engine
 		EngineOptions m_engineOptions;	// Engine-Optionen
 		RepitionMap m_repitionMap;		// Daten fr Stellungswiederholung
 		MinMaxResult m_result;			// Min-Max-Result
+		ROOT_MOVE_LIST m_rootMoves;		// Wurzelzge der aktuellen Suche (Hauptvarianten stehen vorne)
+		PV_TABLE m_pvTable;				// Triangulare PV-Tabelle
+		PV_LENGTH_LIST m_pvLength;		// Lngen der Hauptvarianten in der PV-Tabelle
+		MOVE_LIST m_previousPv;			// Hauptvariante der letzten Iteration bzw. Suche (wird zuerst untersucht)
+		BOOL m_followPv = false;		// Befindet sich der aktuelle Knoten auf m_previousPv?
 		std::mutex m_mutex;				// Mutex-Objekt zum Blockieren des Threads (Zur Speicherung weiterer Member)
+		std::condition_variable m_stopCondition; // Benachrichtigung bei stop() (Analysemodus)
+		SEARCH_INFO_CALLBACK m_searchInfoCallback; // Rckruffunktion fr Suchinformationen
+		std::unique_ptr<EvaluationCache> m_evaluationCache;	// Bewertungs-Zwischenspeicher (bleibt ber mehrere Suchen erhalten)
+		std::unique_ptr<PawnHashTable> m_pawnHashTable;		// Bauern-Hash-Tabelle (bleibt ber mehrere Suchen erhalten)
 
 		INT32 m_startedDepth = 0;		// Starttiefe
 		INT32 m_player;					// Aktueller Spieler der Engine
 
 		// Effizienzmerkmale:
-		INT32 m_nodes;			// Anzahl der durchsuchten Knoten pro Suche
-		INT32 m_prunes;			// Anzahl der Abschneidungen pro Suche
+		std::atomic<INT64> m_nodes{ 0 };	// Anzahl der durchsuchten Knoten pro Suche
+		std::atomic<INT64> m_prunes{ 0 };	// Anzahl der Abschneidungen pro Suche
 		INT64 m_searchTime;		// Zeit fr die Suche in Mikrosekunden
+		INT32 m_selDepth = 0;	// Maximal erreichte Suchtiefe (Halbzge ab der Wurzel)
+		SearchStatistics m_statistics;		// Statistik der laufenden Suche (nur vom Such-Thread geschrieben)
+		SearchStatistics m_lastStatistics;	// Statistik der letzten abgeschlossenen Suche (durch m_mutex geschtzt)
+
+		std::chrono::steady_clock::time_point m_searchStart; // Startzeitpunkt der aktuellen Suche
+		INT64 m_lastCurrMoveReport = 0; // Zeitpunkt der letzten "currmove"-Meldung in ms seit Suchbeginn
 
 		BOOL m_debugMode = false;	// Debug-Modus
-		BOOL m_ready = true;		// Engine wartet auf Input
-		BOOL m_stop = false;		// Soll Suche abgebrochen werden?
+		UCHAR m_evaluationFlags = EVAL_FT_STANDARD; // Feature-Parameter der Bewertungsfunktion
+		SearchLimits m_limits;		// Grenzen der aktuellen Suche
+		std::atomic<BOOL> m_ready{ true };	// Engine wartet auf Input
+		std::atomic<BOOL> m_stop{ false };	// Soll Suche abgebrochen werden?
 	};
 }
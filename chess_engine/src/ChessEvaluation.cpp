@@ -1,51 +1,126 @@
 #include "ChessEvaluation.hpp"
 #include "ChessValidation.hpp"
 #include "ChessEngine.hpp"
+#include "ChessUtility.hpp"
+#include "Bitbase.hpp"
 #include <unordered_map>
+#include <algorithm>
 
 namespace owl
 {
+	thread_local EvaluationCache* ChessEvaluation::s_evaluationCache = nullptr;
+	thread_local PawnHashTable* ChessEvaluation::s_pawnHashTable = nullptr;
+
 	EVALUATION_VALUE ChessEvaluation::evaluate(Position& position, INT32 enginePlayer, UCHAR evaluationFeatureFlags, BOOL validationCheckMate)
 	{
+		switch (evaluationFeatureFlags)
+		{
+		case EVAL_FT_STANDARD: return evaluate<EVAL_FT_STANDARD>(position, enginePlayer, validationCheckMate);
+		case EVAL_FT_NULL: return evaluate<EVAL_FT_NULL>(position, enginePlayer, validationCheckMate);
+		default: return evaluateFeatures<FT_RUNTIME>(position, enginePlayer, evaluationFeatureFlags, -INF, INF, validationCheckMate);
+		}
+	}
+
+	EVALUATION_VALUE ChessEvaluation::evaluate(Position& position, INT32 enginePlayer, UCHAR evaluationFeatureFlags,
+		EVALUATION_VALUE alpha, EVALUATION_VALUE beta, BOOL validationCheckMate)
+	{
+		if (evaluationFeatureFlags == EVAL_FT_STANDARD) return evaluate<EVAL_FT_STANDARD>(position, enginePlayer, alpha, beta, validationCheckMate);
+		return evaluateFeatures<FT_RUNTIME>(position, enginePlayer, evaluationFeatureFlags, alpha, beta, validationCheckMate);
+	}
+
+	template <INT32 Flags>
+	EVALUATION_VALUE ChessEvaluation::evaluate(Position& position, INT32 enginePlayer, BOOL validationCheckMate)
+	{
+		static_assert(Flags != FT_RUNTIME, "evaluate<FT_RUNTIME>() ist nicht erlaubt, stattdessen evaluate() verwenden");
+		return evaluateFeatures<Flags>(position, enginePlayer, static_cast<UCHAR>(Flags), -INF, INF, validationCheckMate);
+	}
+
+	template <INT32 Flags>
+	EVALUATION_VALUE ChessEvaluation::evaluate(Position& position, INT32 enginePlayer, EVALUATION_VALUE alpha, EVALUATION_VALUE beta, BOOL validationCheckMate)
+	{
+		static_assert(Flags != FT_RUNTIME, "evaluate<FT_RUNTIME>() ist nicht erlaubt, stattdessen evaluate() verwenden");
+		return evaluateFeatures<Flags>(position, enginePlayer, static_cast<UCHAR>(Flags), alpha, beta, validationCheckMate);
+	}
+
+	template <INT32 Flags>
+	EVALUATION_VALUE ChessEvaluation::evaluateFeatures(Position& position, INT32 enginePlayer, UCHAR evaluationFeatureFlags,
+		EVALUATION_VALUE alpha, EVALUATION_VALUE beta, BOOL validationCheckMate)
+	{
+		const auto features = FEATURE_FLAGS<Flags>(evaluationFeatureFlags);
+
 		// Checkmate berprfen?
-		// Hinweis: getValidMoves() berechnet das Checkmate intern und es soll nur bei "in Schach"-Stellungen
-		// die Liste der mglichen Zge berechnet werden. Andernfalls wird nicht von einer Endstellung ausgegangen.
-		// Vorteil: Mehr Effizienz
+		// Hinweis: Nur der Spieler am Zug kann matt gesetzt sein. Das Schach wird je Knoten einmal bestimmt
+		// und nur dann nach einem legalen Zug gesucht (Abbruch beim ersten Treffer statt vollstndiger Zugliste).
+		// Ohne Schach wird nicht von einer Endstellung ausgegangen.
 		if (validationCheckMate)
 		{
-			// Gegnerische Knig im Schach && Gegnerischer Spieler am Zug?
-			if (ChessValidation::isKingInCheck(position, -enginePlayer) && position.getPlayer() == -enginePlayer)
-			{
-				ChessValidation::getValidMoves(position, -enginePlayer);
-			}
-			// Eigener Knig im Schach && Selber am Zug?
-			else if (ChessValidation::isKingInCheck(position, enginePlayer) && position.getPlayer() == enginePlayer)
+			auto player = position.getPlayer();
+			auto in_check = ChessValidation::isKingInCheck(position, player);
+
+			if (in_check && !ChessValidation::hasLegalMove(position, player))
 			{
-				ChessValidation::getValidMoves(position, enginePlayer);
+				position.setGameState(player == PLAYER_WHITE ? GameState::PlayerBlackWins : GameState::PlayerWhiteWins);
 			}
 		}
 
 		// Ist die Position eine Endstellung?
 		if ((position.getGameState() == GameState::PlayerBlackWins && enginePlayer == PLAYER_WHITE)
 			|| position.getGameState() == GameState::PlayerWhiteWins && enginePlayer == PLAYER_BLACK) 
-			return -INF;
+			return -MATE_VALUE;
 		if ((position.getGameState() == GameState::PlayerBlackWins && enginePlayer == PLAYER_BLACK)
 			|| position.getGameState() == GameState::PlayerWhiteWins && enginePlayer == PLAYER_WHITE) 
-			return INF;
-		if (position.getGameState() == GameState::Remis) return 0.00f;
-
-	#if OWL_USE_EVALUATION_COMPONENT_REPRESENTAION==true
-		EVALUATION_VALUE data[PLAYER_COUNT];
-
-		std::array<FLOAT*, PLAYER_COUNT> score				= {&data[WHITE_INDEX].score,		 &data[BLACK_INDEX].score };
-		std::array<FLOAT*, PLAYER_COUNT> material			= {&data[WHITE_INDEX].material,		 &data[BLACK_INDEX].material };
-		std::array<FLOAT*, PLAYER_COUNT> game_phase			= {&data[WHITE_INDEX].gamePhase,	 &data[BLACK_INDEX].gamePhase };
-		std::array<FLOAT*, PLAYER_COUNT> square_table		= {&data[WHITE_INDEX].squareTable,	 &data[BLACK_INDEX].squareTable };
-		std::array<FLOAT*, PLAYER_COUNT> piece_mobility		= {&data[WHITE_INDEX].pieceMobility, &data[BLACK_INDEX].pieceMobility };
-		std::array<FLOAT*, PLAYER_COUNT> pawn_structure		= {&data[WHITE_INDEX].pawnStructure, &data[BLACK_INDEX].pawnStructure };
-		std::array<FLOAT*, PLAYER_COUNT> bishop_pair		= {&data[WHITE_INDEX].bishopPair,	 &data[BLACK_INDEX].bishopPair };
-		std::array<FLOAT*, PLAYER_COUNT> dynamic_pawns		= {&data[WHITE_INDEX].dynamicPawns,	 &data[BLACK_INDEX].dynamicPawns };
-	#else
+			return MATE_VALUE;
+		if (position.getGameState() == GameState::Remis) return DRAW_VALUE;
+
+		// Exaktes Ergebnis aus den Bitbasen (KPK, KRK, KQK)?
+		auto bitbase = Bitbase::probe(position);
+		if (bitbase == GameState::Remis) return DRAW_VALUE;
+
+		// Bereits bewertet?
+		auto& evaluation_cache = getEvaluationCache();
+		auto cache_key = EvaluationCache::getKey(position, enginePlayer, features);
+		
+		if (auto cache_entry = evaluation_cache.probe(cache_key)) return cache_entry->score;
+
+		// Gewonnene Bitbasis-Stellungen exakt bewerten (keine Schranke), die Heuristik dient nur dem Fortschritt
+		if (bitbase != GameState::Active)
+		{
+			alpha = -INF;
+			beta = INF;
+		}
+
+		BOOL exact;
+		EVALUATION_VALUE final_score = ChessUtility::convertToCentipawns(evaluateTerms<Flags>(position, enginePlayer, features, alpha, beta, exact, nullptr));
+
+		if (bitbase == GameState::PlayerWhiteWins) final_score += enginePlayer == PLAYER_WHITE ? BITBASE_WIN_VALUE : -BITBASE_WIN_VALUE;
+		if (bitbase == GameState::PlayerBlackWins) final_score += enginePlayer == PLAYER_BLACK ? BITBASE_WIN_VALUE : -BITBASE_WIN_VALUE;
+
+		// Schranken der Lazy Evaluation nicht zwischenspeichern
+		if (!exact) return final_score;
+
+		EvaluationCacheEntry cache_entry;
+		cache_entry.key = cache_key;
+		cache_entry.score = final_score;
+		evaluation_cache.store(cache_entry);
+
+		return final_score;
+	}
+
+	EvaluationDataScore ChessEvaluation::trace(const Position& position, INT32 enginePlayer, UCHAR evaluationFeatureFlags)
+	{
+		EvaluationDataScore data;
+		BOOL exact;
+		evaluateTerms<FT_RUNTIME>(position, enginePlayer, evaluationFeatureFlags, -INF, INF, exact, &data);
+		return data;
+	}
+
+	template <INT32 Flags>
+	FLOAT ChessEvaluation::evaluateTerms(const Position& position, INT32 enginePlayer, UCHAR evaluationFeatureFlags,
+		EVALUATION_VALUE alpha, EVALUATION_VALUE beta, BOOL& exact, EvaluationDataScore* trace)
+	{
+		// Fr feste Flags ist features eine Konstante und alle Abfragen der Features entfallen
+		const auto features = FEATURE_FLAGS<Flags>(evaluationFeatureFlags);
+
 		FLOAT _score[PLAYER_COUNT]			= { 0.0f };
 		FLOAT _material[PLAYER_COUNT]		= { 0.0f };
 		FLOAT _game_phase[PLAYER_COUNT]		= { 0.0f };
@@ -55,7 +130,6 @@ namespace owl
 		FLOAT _bishop_pair[PLAYER_COUNT]	= { 0.0f };
 		FLOAT _dynamic_pawns[PLAYER_COUNT]	= { 0.0f };
 
-		std::array<FLOAT*, PLAYER_COUNT> score				= {&_score[WHITE_INDEX], &_score[BLACK_INDEX] };
 		std::array<FLOAT*, PLAYER_COUNT> material			= {&_material[WHITE_INDEX], &_material[BLACK_INDEX] };
 		std::array<FLOAT*, PLAYER_COUNT> game_phase			= {&_game_phase[WHITE_INDEX], &_game_phase[BLACK_INDEX] };
 		std::array<FLOAT*, PLAYER_COUNT> square_table		= {&_square_table[WHITE_INDEX],	&_square_table[BLACK_INDEX]};
@@ -63,130 +137,41 @@ namespace owl
 		std::array<FLOAT*, PLAYER_COUNT> pawn_structure		= {&_pawn_structure[WHITE_INDEX], &_pawn_structure[BLACK_INDEX]};
 		std::array<FLOAT*, PLAYER_COUNT> bishop_pair		= {&_bishop_pair[WHITE_INDEX], &_bishop_pair[BLACK_INDEX]};
 		std::array<FLOAT*, PLAYER_COUNT> dynamic_pawns		= {&_dynamic_pawns[WHITE_INDEX], &_dynamic_pawns[BLACK_INDEX]};
-	#endif
 
-		PAIR<INT32, INT32> king_pos[PLAYER_COUNT] = {{0, 0}};
+		// Material, Figurenanzahl und Piece-Square-Tabellen werden von Position inkrementell aktualisiert
+		const auto& incremental = position.getIncrementalEvaluation();
+		const auto& piece_count = incremental.pieceCount;
 
-		INT32 piece_count[PLAYER_COUNT][MAX_PIECE_TYPES] = { {0} };	 // Figurenanzahl
 		INT32 possible_moves[PLAYER_COUNT][MAX_PIECE_TYPES] = { {0} }; // Piece Mobility Count
 
-		// Pro Spielfeld Figure zhlen und Materialwert hinzutragen
-		// Anmerkung: Der Materialwert der Bauern wird spter zu white_score bzw. black_score hinzugetragen, 
-		// da der Wert fr die Berechnung, ob die Position eine Endstellung ist, nicht bercksichtig werden soll
-		for (INT32 y = FIRST_ROW_INDEX; y < ROWS; y++)
+		for (INT32 color = FIRST_PLAYER_INDEX; color < PLAYER_COUNT; color++)
 		{
-			for (INT32 x = FIRST_COLUMN_INDEX; x < COLUMNS; x++)
-			{
-				auto piece = position[y][x];
-
-				// Leere Felder berspringen:
-				if (piece == EMPTY_FIELD)
-					continue;
-
-				auto type = GET_PIECE_INDEX_BY_TYPE(piece);
-
-				if (type < 0 || type >= MAX_PIECE_TYPES) continue;
-
-				auto color = GET_PLAYER_INDEX_BY_PIECE(piece);
-
-				piece_count[color][type]++;
-
-				auto passed_progress_index = color == WHITE_INDEX ? LAST_ROW_INDEX - y : y;
-
-				// Bauernstruktur bestimmen
-				if (evaluationFeatureFlags & EVAL_FT_PAWN_STRUCTURE && type == PAWN_INDEX)
-				{
-					auto is_double = isDoublePawn(position, x, y);
-					auto is_connected = isConnectedPawn(position, x, y);
-					auto is_chain = isChainPawn(position, x, y);
-					auto is_passed = isPassedPawn(position, x, y);
-
-					auto is_isolated = !(is_connected || is_chain);
-					auto is_backwards = !is_connected ? isBackwardsPawn(position, x, y) : false;
-
-					auto is_isolated_double = is_double && is_isolated;
-					auto is_connected_passed = is_connected && is_passed;
-
-					if (is_double)		*pawn_structure[color] += PAWN_STRUCTURE_DOUBLE_PAWNS_PENALTY * PAWN_STRUCTURE_WEIGHT;
-					if (is_connected)	*pawn_structure[color] += PAWN_STRUCTURE_CONNECTED_PAWNS_BONUS * PAWN_STRUCTURE_WEIGHT;
-					if (is_chain)		*pawn_structure[color] += PAWN_STRUCTURE_CHAIN_PAWNS_BONUS * PAWN_STRUCTURE_WEIGHT;
-					if (is_passed)		*pawn_structure[color] += (PAWN_STRUCTURE_PASSED_PAWNS_BONUS + PASSED_PAWNS_PROGRESS_BONUS[passed_progress_index]) * PAWN_STRUCTURE_WEIGHT;
-				
-					if (is_isolated)	*pawn_structure[color] += PAWN_STRUCTURE_ISOLATED_PAWNS_PENALTY * PAWN_STRUCTURE_WEIGHT;
-					if (is_backwards)	*pawn_structure[color] += PAWN_STRUCTURE_BACKWARDS_PAWNS_PENALTY * PAWN_STRUCTURE_WEIGHT;
-
-					if (is_isolated_double) *pawn_structure[color] += PAWN_STRUCTURE_ISOLATED_DOUBLE_PAWNS_PENALTY * PAWN_STRUCTURE_WEIGHT;
-					if (is_connected_passed) *pawn_structure[color] += PAWN_STRUCTURE_CONNECTED_PASSED_PAWNS_BONUS * PAWN_STRUCTURE_WEIGHT;
-				}
-
-				if(type >= 0 && type < MAX_PIECE_TYPES) *material[color] += MATERIAL_VALUES[type];
-
-				// Piece Mobility Zge zhlen
-				if (evaluationFeatureFlags & EVAL_FT_PIECE_MOBILITY)
-				{
-					possible_moves[color][type] += ChessValidation::countPossibleMovesOnField(position, x, y, true);
-				}
-
-				// Square Table addieren (Zunchst ohne Knig)
-				if (evaluationFeatureFlags & EVAL_FT_PIECE_SQUARE_TABLE)
-				{
-					auto table_index = x + (COLUMNS * y);
-					auto amount = 0.0f;
-
-					switch (piece)
-					{
-					case WHITE_PAWN:	amount += PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_PAWN_WEIGHT	* PIECE_SQUARE_TABLE_PAWN[table_index]; break;
-					case WHITE_KNIGHT:	amount += PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_KNIGHT_WEIGHT	* PIECE_SQUARE_TABLE_KNIGHT[table_index]; break;
-					case WHITE_BISHOP:	amount += PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_BISHOP_WEIGHT	* PIECE_SQUARE_TABLE_BISHOP[table_index]; break;
-					case WHITE_ROOK:	amount += PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_ROOK_WEIGHT	* PIECE_SQUARE_TABLE_ROOK[table_index]; break;
-					case WHITE_QUEEN:	amount += PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_QUEEN_WEIGHT	* PIECE_SQUARE_TABLE_QUEEN[table_index]; break;
-
-					case BLACK_PAWN:	amount += PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_PAWN_WEIGHT	* MIRROR_PIECE_SQUARE_TABLE(PIECE_SQUARE_TABLE_PAWN)[table_index]; break;
-					case BLACK_KNIGHT:	amount += PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_KNIGHT_WEIGHT	* MIRROR_PIECE_SQUARE_TABLE(PIECE_SQUARE_TABLE_KNIGHT)[table_index]; break;
-					case BLACK_BISHOP:	amount += PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_BISHOP_WEIGHT	* MIRROR_PIECE_SQUARE_TABLE(PIECE_SQUARE_TABLE_BISHOP)[table_index]; break;
-					case BLACK_ROOK:	amount += PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_ROOK_WEIGHT	* MIRROR_PIECE_SQUARE_TABLE(PIECE_SQUARE_TABLE_ROOK)[table_index]; break;
-					case BLACK_QUEEN:	amount += PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_QUEEN_WEIGHT	* MIRROR_PIECE_SQUARE_TABLE(PIECE_SQUARE_TABLE_QUEEN)[table_index]; break;
-					// Bestimme die Positionen der Knige, um diese nach den Iterationen der Square-Table hinzuzufgen, 
-					// da die Spielphase erst spter bestimmt werden kann und es fr Mittel- und Endspiel unterschiedliche Tabellen gibt
-					case WHITE_KING:
-					case BLACK_KING: 
-						king_pos[color] = { x,y }; 
-						break;
-					}
-					*square_table[color] += amount;
-				}
-			}
+			*material[color] += incremental.material[color];
 		}
 
-		// Spielphase abfragen
-		auto pos_game_phase = position.getGamePhase();
-		auto both_material = *score[WHITE_INDEX] + *score[BLACK_INDEX];
+		// Kontinuierliche Spielphase: Mittel- und Endspielwerte werden damit interpoliert
+		auto phase = getPhase(position);
 
-		// Spielphase bestimmen bzw. anpassen
-		if (pos_game_phase == GamePhase::Opening && both_material <= MAX_MATERIAL_SUM_MID_GAME)	position.enterNextGamePhase();
-		if (pos_game_phase == GamePhase::Mid && both_material <= MAX_MATERIAL_SUM_END_GAME)		position.enterNextGamePhase();
-		
 		// Dynamischer Bonus fr den Materialwert je Spielphase
-		if (evaluationFeatureFlags & EVAL_FT_MATERIAL_DYNAMIC_GAME_PHASE)
+		if (features & EVAL_FT_MATERIAL_DYNAMIC_GAME_PHASE)
 		{
 			for (INT32 color_index = FIRST_PLAYER_INDEX; color_index < PLAYER_COUNT; color_index++)
 			{
+				auto mid_game = 0.0f;
+				auto end_game = 0.0f;
+
 				for (INT32 type_index = FIRST_PIECE_TYPES_INDEX; type_index < MAX_PIECE_TYPES; type_index++)
 				{
-					auto factor = 1.0f;
-					switch (pos_game_phase)
-					{
-					case GamePhase::Opening: factor = MATERIAL_ADDITION_BEGIN_GAME_PHASE[type_index]; break;
-					case GamePhase::Mid: factor = MATERIAL_ADDITION_MID_GAME_PHASE[type_index]; break;
-					case GamePhase::End: factor = MATERIAL_ADDITION_END_GAME_PHASE[type_index]; break;
-					}
-					*game_phase[color_index] += piece_count[color_index][type_index] * factor * MATERIAL_DYNAMIC_GAME_PHASE_WEIGHT;
+					mid_game += piece_count[color_index][type_index] * MATERIAL_ADDITION_BEGIN_GAME_PHASE[type_index];
+					end_game += piece_count[color_index][type_index] * MATERIAL_ADDITION_END_GAME_PHASE[type_index];
 				}
+
+				*game_phase[color_index] += taper(mid_game, end_game, phase) * MATERIAL_DYNAMIC_GAME_PHASE_WEIGHT;
 			}
 		}
 
 		// Dynamische Bauern aktiviert?
-		if (evaluationFeatureFlags & EVAL_FT_DYNAMIC_PAWNS)
+		if (features & EVAL_FT_DYNAMIC_PAWNS)
 		{
 			for (auto color = FIRST_PLAYER_INDEX; color < PLAYER_COUNT; color++)
 			{
@@ -195,34 +180,17 @@ namespace owl
 			}
 		}
 
-		// Piece Square Table fr Knig hinzufgen
- 		if (evaluationFeatureFlags & EVAL_FT_PIECE_SQUARE_TABLE && pos_game_phase != GamePhase::Opening)
+		// Piece Square Table hinzufgen (Mittel- und Endspieltabellen interpolieren)
+		if (features & EVAL_FT_PIECE_SQUARE_TABLE)
 		{
-			INT32 table_index[PLAYER_COUNT] =
-			{
-				king_pos[WHITE_INDEX].first + ((COLUMNS * king_pos[WHITE_INDEX].second)),
-				king_pos[BLACK_INDEX].first + ((COLUMNS * king_pos[BLACK_INDEX].second))
-			};
-
-			float factor[PLAYER_COUNT] = { 0.0f };
-
-			switch (pos_game_phase)
+			for (INT32 color_index = FIRST_PLAYER_INDEX; color_index < PLAYER_COUNT; color_index++)
 			{
-			case GamePhase::Mid: 
-				factor[WHITE_INDEX] = PIECE_SQUARE_TABLE_KING_MID_GAME_WEIGHT * PIECE_SQUARE_TABLE_KING_MID_GAME[table_index[WHITE_INDEX]];
-				factor[BLACK_INDEX] = PIECE_SQUARE_TABLE_KING_MID_GAME_WEIGHT * MIRROR_PIECE_SQUARE_TABLE(PIECE_SQUARE_TABLE_KING_MID_GAME)[table_index[BLACK_INDEX]];
-				break;
-			case GamePhase::End: 
-				factor[WHITE_INDEX] = PIECE_SQUARE_TABLE_KING_END_GAME_WEIGHT * PIECE_SQUARE_TABLE_KING_END_GAME[table_index[WHITE_INDEX]];
-				factor[BLACK_INDEX] = PIECE_SQUARE_TABLE_KING_END_GAME_WEIGHT * MIRROR_PIECE_SQUARE_TABLE(PIECE_SQUARE_TABLE_KING_END_GAME)[table_index[BLACK_INDEX]];
-				break;
+				*square_table[color_index] += taper(incremental.squareTableMid[color_index], incremental.squareTableEnd[color_index], phase);
 			}
-			*square_table[WHITE_INDEX] += piece_count[WHITE_INDEX][KING_INDEX] * factor[WHITE_INDEX];
-			*square_table[BLACK_INDEX] += piece_count[BLACK_INDEX][KING_INDEX] * factor[BLACK_INDEX];
 		}
 
 		// Luferpaar aktiviert?
-		if (evaluationFeatureFlags & EVAL_FT_BISHOP_PAIR)
+		if (features & EVAL_FT_BISHOP_PAIR)
 		{
 			for (auto color_index = FIRST_PLAYER_INDEX; color_index < PLAYER_COUNT; color_index++)
 			{
@@ -231,24 +199,77 @@ namespace owl
 			}
 		}
 
-		// Piece Mobility hinzufgen:
-		if (evaluationFeatureFlags & EVAL_FT_PIECE_MOBILITY)
+		auto own = GetPlayerIndexByPositionPlayer(enginePlayer);
+		auto enemy = GetPlayerIndexByPositionPlayer(-enginePlayer);
+
+		// Lazy Evaluation: Kann die Teilbewertung der gnstigen Komponenten auch mit den grtmglichen Beitrgen von
+		// Bauernstruktur und Mobilitt nicht mehr in das Fenster gelangen, wird die Schranke zurckgegeben
+		if (features & (EVAL_FT_PAWN_STRUCTURE | EVAL_FT_PIECE_MOBILITY))
 		{
+			auto partial_score = (_material[own] + _game_phase[own] + _square_table[own] + _bishop_pair[own] + _dynamic_pawns[own])
+				- (_material[enemy] + _game_phase[enemy] + _square_table[enemy] + _bishop_pair[enemy] + _dynamic_pawns[enemy]);
+
+			// Grtmglicher Gewinn und Verlust je Spieler aus der Figurenanzahl
+			FLOAT gain[PLAYER_COUNT] = { 0.0f }, loss[PLAYER_COUNT] = { 0.0f };
+			for (INT32 color_index = FIRST_PLAYER_INDEX; color_index < PLAYER_COUNT; color_index++)
+			{
+				if (features & EVAL_FT_PIECE_MOBILITY)
+				{
+					for (INT32 type_index = FIRST_PIECE_TYPES_INDEX; type_index < MAX_PIECE_TYPES; type_index++)
+						gain[color_index] += PIECE_MOBILITY_WEIGHT * PIECE_MOBILITY_TYPE_WEIGHTS[type_index] * PIECE_MOBILITY_MAX[type_index] * piece_count[color_index][type_index];
+				}
+				if (features & EVAL_FT_PAWN_STRUCTURE)
+				{
+					gain[color_index] += PAWN_STRUCTURE_MAX_BONUS * piece_count[color_index][PAWN_INDEX];
+					loss[color_index] += PAWN_STRUCTURE_MAX_PENALTY * piece_count[color_index][PAWN_INDEX];
+				}
+			}
+
+			auto upper_bound = partial_score + gain[own] + loss[enemy];
+			auto lower_bound = partial_score - gain[enemy] - loss[own];
+
+			if (upper_bound <= alpha / CENTIPAWNS_PER_PAWN)
+			{
+				exact = false;
+				return upper_bound;
+			}
+			if (lower_bound >= beta / CENTIPAWNS_PER_PAWN)
+			{
+				exact = false;
+				return lower_bound;
+			}
+		}
+
+		// Bauernstruktur aus der Bauern-Hash-Tabelle lesen bzw. berechnen
+		if (features & EVAL_FT_PAWN_STRUCTURE)
+		{
+			auto pawn_key = position.getPawnKey();
+			auto& pawn_hash_table = getPawnHashTable();
+			auto pawn_entry = pawn_hash_table.probe(pawn_key);
+
+			PawnHashEntry entry;
+			if (pawn_entry == nullptr)
+			{
+				entry.key = pawn_key;
+				evaluatePawnStructure(position, entry);
+				pawn_hash_table.store(entry);
+				pawn_entry = &entry;
+			}
+
+			*pawn_structure[WHITE_INDEX] += pawn_entry->score[WHITE_INDEX];
+			*pawn_structure[BLACK_INDEX] += pawn_entry->score[BLACK_INDEX];
+		}
+
+		// Piece Mobility aus den Angriffsfeldern bestimmen und hinzufgen:
+		if (features & EVAL_FT_PIECE_MOBILITY)
+		{
+			countMobility(position, possible_moves);
+
 			for (INT32 color_index = FIRST_PLAYER_INDEX; color_index < PLAYER_COUNT; color_index++)
 			{
 				for (INT32 type_index = FIRST_PIECE_TYPES_INDEX; type_index < MAX_PIECE_TYPES; type_index++)
 				{
-					auto factor = 1.0f;
-					switch (type_index)
-					{
-					case PAWN_INDEX: factor = PIECE_MOBILITY_PAWN_WEIGHT; break;
-					case KNIGHT_INDEX: factor = PIECE_MOBILITY_KNIGHT_WEIGHT; break;
-					case BISHOP_INDEX: factor = PIECE_MOBILITY_BISHOP_WEIGHT; break;
-					case ROOK_INDEX: factor = PIECE_MOBILITY_ROOK_WEIGHT; break;
-					case QUEEN_INDEX: factor = PIECE_MOBILITY_QUEEN_WEIGHT; break;
-					case KING_INDEX: factor = PIECE_MOBILITY_KING_WEIGHT; break;
-					}
-					*piece_mobility[color_index] += PIECE_MOBILITY_WEIGHT * factor * possible_moves[color_index][type_index];
+					*piece_mobility[color_index] += PIECE_MOBILITY_WEIGHT * PIECE_MOBILITY_TYPE_WEIGHTS[type_index] * possible_moves[color_index][type_index];
                     //std::cout << *piece_mobility[color_index] << " ";
 				}
 			}
@@ -257,103 +278,272 @@ namespace owl
 		// Materialwerte summieren
 		for (INT32 color_index = FIRST_PLAYER_INDEX; color_index < PLAYER_COUNT; color_index++)
 		{
-		#if OWL_USE_EVALUATION_COMPONENT_REPRESENTAION==true
-			data[color_index].calculateScore();
-		#else
 			_score[color_index] += _material[color_index] + _game_phase[color_index] + _square_table[color_index]
 				+ _piece_mobility[color_index] + _pawn_structure[color_index] + _bishop_pair[color_index] + _dynamic_pawns[color_index];
-		#endif
 		}
 
-		// Je nach Spieler score der Spieler voneinander abziehen und zurckgeben
-	#if OWL_USE_EVALUATION_COMPONENT_REPRESENTAION==true
-		EVALUATION_VALUE final_score = enginePlayer == PLAYER_WHITE ?
-			data[WHITE_INDEX] - data[BLACK_INDEX] :
-			data[BLACK_INDEX] - data[WHITE_INDEX];
-	#else
-		EVALUATION_VALUE final_score = enginePlayer == PLAYER_WHITE ?
-			_score[WHITE_INDEX] - _score[BLACK_INDEX] :
-			_score[BLACK_INDEX] - _score[WHITE_INDEX];
-	#endif
-		return final_score;
+		// Aufschlsselung nur fr die Ausgabe (trace()) befllen
+		if (trace != nullptr)
+		{
+			trace->material = _material[own] - _material[enemy];
+			trace->gamePhase = _game_phase[own] - _game_phase[enemy];
+			trace->squareTable = _square_table[own] - _square_table[enemy];
+			trace->pieceMobility = _piece_mobility[own] - _piece_mobility[enemy];
+			trace->pawnStructure = _pawn_structure[own] - _pawn_structure[enemy];
+			trace->bishopPair = _bishop_pair[own] - _bishop_pair[enemy];
+			trace->dynamicPawns = _dynamic_pawns[own] - _dynamic_pawns[enemy];
+			trace->calculateScore();
+		}
+
+		// Je nach Spieler score der Spieler voneinander abziehen
+		exact = true;
+		return _score[own] - _score[enemy];
 	}
 
-	BOOL ChessEvaluation::isDoublePawn(const Position& position, INT32 x, INT32 y)
+	EVALUATION_VALUE ChessEvaluation::staticExchangeEvaluation(const Position& position, const Move& move)
 	{
-		if (isPawnPieceAlliedOnOffset(position, x, y, 0, 1)) return true;
-		if (isPawnPieceAlliedOnOffset(position, x, y, 0, -1)) return true;
+		auto from = move.startY * COLUMNS + move.startX;
+		auto to = move.targetY * COLUMNS + move.targetX;
 
-		return false;
-	}
-	BOOL ChessEvaluation::isConnectedPawn(const Position& position, INT32 x, INT32 y)
-	{
-		if (isPawnPieceAlliedOnOffset(position, x, y, 1, 0)) return true;		
-		if (isPawnPieceAlliedOnOffset(position, x, y, -1, 0)) return true;
+		BITBOARD pieces[PLAYER_COUNT] = { bitboard::EMPTY_BOARD };
+		for (INT32 color = FIRST_PLAYER_INDEX; color < PLAYER_COUNT; color++)
+		{
+			for (INT32 type = FIRST_PIECE_TYPES_INDEX; type < MAX_PIECE_TYPES; type++) pieces[color] |= position.getBitboard(color, type);
+		}
 
-		return false;
-	}
+		// Figurentyp auf einem Feld bestimmen
+		auto piece_type = [&position](INT32 color, BITBOARD square) {
+			for (INT32 type = FIRST_PIECE_TYPES_INDEX; type < MAX_PIECE_TYPES; type++)
+			{
+				if (position.getBitboard(color, type) & square) return type;
+			}
+			return static_cast<INT32>(EMPTY);
+		};
 
-	BOOL ChessEvaluation::isBackwardsPawn(const Position& position, INT32 x, INT32 y)
-	{
-		// Hinweis: isConnectedPawn(...) muss vorher false sein
-		auto dir = position.getPlayer();
+		auto side = pieces[WHITE_INDEX] & (1ULL << from) ? WHITE_INDEX : BLACK_INDEX;
+		auto occupied = pieces[WHITE_INDEX] | pieces[BLACK_INDEX];
+		auto attacker = piece_type(side, 1ULL << from);
+		auto victim = piece_type(1 - side, 1ULL << to);
 
-		// Gegnerischer Bauer vorne
-		if (isPawnPieceHostileOnOffset(position, x, y, 0, dir)) return true;
-		if (isPawnPieceHostileOnOffset(position, x, y, 1, 2 * dir)) return true;
-		if (isPawnPieceHostileOnOffset(position, x, y, -1, 2 * dir)) return true;
+		EVALUATION_VALUE gain[MAX_EXCHANGE_SEQUENCE] = { 0 };
 
-		return false;
-	}
-	BOOL ChessEvaluation::isPassedPawn(const Position& position, INT32 x, INT32 y)
-	{
-		auto enemy_pawn = position[y][x] == WHITE_PAWN ? WHITE_PAWN: BLACK_PAWN;
+		if (move.enPassantCapture)
+		{
+			victim = PAWN_INDEX;
+			occupied ^= bitboard::SQUARE(move.targetX, move.startY);
+		}
+		gain[0] = victim == EMPTY ? 0 : SEE_VALUES[victim];
 
-		for (INT32 i = 0; i < ROWS; i++)
+		// Bauernumwandlung: Die umgewandelte Figur steht danach auf dem Feld
+		if (move.promotion)
 		{
-			if (i == y) continue; // Eigenes Feld ignorieren
-			if (ChessValidation::isInsideChessboard(x, i))
+			attacker = GET_PIECE_INDEX_BY_TYPE(move.promotion);
+			gain[0] += SEE_VALUES[attacker] - SEE_VALUES[PAWN_INDEX];
+		}
+
+		BITBOARD from_square = 1ULL << from;
+		auto depth = 0;
+
+		do
+		{
+			// Spekulativer Gewinn, falls die Figur auf dem Feld zurckgeschlagen wird
+			depth++;
+			gain[depth] = SEE_VALUES[attacker] - gain[depth - 1];
+
+			// Keine Seite kann sich durch weiteres Schlagen verbessern
+			if (std::max(-gain[depth - 1], gain[depth]) < 0) break;
+
+			// Schlagende Figur entfernen, dadurch werden ggf. Rntgenangriffe frei
+			occupied ^= from_square;
+			auto attackers = getAttackers(position, to, occupied) & occupied;
+
+			// Geringwertigste Figur des Gegners schlgt zurck
+			side = 1 - side;
+			from_square = bitboard::EMPTY_BOARD;
+			for (INT32 type = FIRST_PIECE_TYPES_INDEX; type < MAX_PIECE_TYPES; type++)
 			{
-				if (position[i][x] == enemy_pawn) return false;
+				auto candidates = attackers & position.getBitboard(side, type);
+				if (candidates)
+				{
+					from_square = candidates & (~candidates + 1);
+					attacker = type;
+					break;
+				}
 			}
+		} while (from_square && depth < MAX_EXCHANGE_SEQUENCE - 1);
+
+		// Schlagabfolge rckwrts auswerten (jede Seite darf aufhren)
+		while (--depth) gain[depth - 1] = -std::max(-gain[depth - 1], gain[depth]);
+
+		return gain[0];
+	}
+
+	BITBOARD ChessEvaluation::getAttackers(const Position& position, INT32 square, BITBOARD occupied)
+	{
+		auto target = 1ULL << square;
+		auto diagonal = bitboard::EMPTY_BOARD;
+		auto straight = bitboard::EMPTY_BOARD;
+		auto attackers = bitboard::EMPTY_BOARD;
+
+		for (INT32 color = FIRST_PLAYER_INDEX; color < PLAYER_COUNT; color++)
+		{
+			// Bauern greifen das Feld an, wenn ein gegnerischer Bauer auf dem Feld sie angreifen wrde
+			attackers |= bitboard::PAWN_ATTACKS(1 - color, target) & position.getBitboard(color, PAWN_INDEX);
+			attackers |= bitboard::KNIGHT_ATTACKS[square] & position.getBitboard(color, KNIGHT_INDEX);
+			attackers |= bitboard::KING_ATTACKS[square] & position.getBitboard(color, KING_INDEX);
+
+			diagonal |= position.getBitboard(color, BISHOP_INDEX) | position.getBitboard(color, QUEEN_INDEX);
+			straight |= position.getBitboard(color, ROOK_INDEX) | position.getBitboard(color, QUEEN_INDEX);
 		}
 
-		return true;
+		attackers |= bitboard::BISHOP_ATTACKS(square, occupied) & diagonal;
+		attackers |= bitboard::ROOK_ATTACKS(square, occupied) & straight;
+
+		return attackers;
 	}
-	BOOL ChessEvaluation::isChainPawn(const Position& position, INT32 x, INT32 y)
+
+	FLOAT ChessEvaluation::getPhase(const Position& position)
 	{
-		if (isPawnPieceAlliedOnOffset(position, x, y, 1, 1)) return true;
-		if (isPawnPieceAlliedOnOffset(position, x, y, 1, -1)) return true;
-		if (isPawnPieceAlliedOnOffset(position, x, y, -1, 1)) return true;
-		if (isPawnPieceAlliedOnOffset(position, x, y, -1, -1)) return true;
+		const auto& incremental = position.getIncrementalEvaluation();
+		auto non_pawn_material = incremental.nonPawnMaterial[WHITE_INDEX] + incremental.nonPawnMaterial[BLACK_INDEX];
+		auto phase = (non_pawn_material - MAX_NON_PAWN_MATERIAL_SUM_END_GAME) / (MAX_NON_PAWN_MATERIAL_SUM - MAX_NON_PAWN_MATERIAL_SUM_END_GAME);
 
-		return false;
+		return std::clamp(phase, PHASE_END_GAME, PHASE_MID_GAME);
 	}
 
-	BOOL ChessEvaluation::isPawnPieceAlliedOnOffset(const Position& position, INT32 x, INT32 y, INT32 xOffset, INT32 yOffset)
+	FLOAT ChessEvaluation::taper(FLOAT midGame, FLOAT endGame, FLOAT phase)
 	{
-		if (ChessValidation::isInsideChessboard(x + xOffset, y + yOffset))
-		{
-			if (position[y][x] == position[y + yOffset][x + xOffset]) return true;
-		}
+		return midGame * phase + endGame * (PHASE_MID_GAME - phase);
+	}
+
+	PawnHashTable& ChessEvaluation::getPawnHashTable()
+	{
+		if (s_pawnHashTable) return *s_pawnHashTable;
+
+		thread_local PawnHashTable pawn_hash_table;
+		return pawn_hash_table;
+	}
+
+	EvaluationCache& ChessEvaluation::getEvaluationCache()
+	{
+		if (s_evaluationCache) return *s_evaluationCache;
+
+		thread_local EvaluationCache evaluation_cache;
+		return evaluation_cache;
+	}
 
-		return false;
+	VOID ChessEvaluation::bindCaches(EvaluationCache* evaluationCache, PawnHashTable* pawnHashTable)
+	{
+		s_evaluationCache = evaluationCache;
+		s_pawnHashTable = pawnHashTable;
 	}
-	BOOL ChessEvaluation::isPawnPieceHostileOnOffset(const Position& position, INT32 x, INT32 y, INT32 xOffset, INT32 yOffset)
+
+	VOID ChessEvaluation::countMobility(const Position& position, INT32 (&possibleMoves)[PLAYER_COUNT][MAX_PIECE_TYPES])
 	{
-		auto start_color = GetPlayerIndexByPositionPlayer(position.getPlayer());
-		auto target_color = start_color + 1 % PLAYER_COUNT;
+		BITBOARD pieces[PLAYER_COUNT] = { bitboard::EMPTY_BOARD };
+
+		for (INT32 color = FIRST_PLAYER_INDEX; color < PLAYER_COUNT; color++)
+		{
+			for (INT32 type = FIRST_PIECE_TYPES_INDEX; type < MAX_PIECE_TYPES; type++) pieces[color] |= position.getBitboard(color, type);
+		}
 
-		auto start_pawn = PIECES[start_color][PAWN_INDEX];
-		auto target_pawn = PIECES[target_color][PAWN_INDEX];
+		auto occupied = pieces[WHITE_INDEX] | pieces[BLACK_INDEX];
 
-		if (ChessValidation::isInsideChessboard(x + xOffset, y + yOffset))
+		for (INT32 color = FIRST_PLAYER_INDEX; color < PLAYER_COUNT; color++)
 		{
-			if (position[y][x] == start_pawn && target_pawn == position[y + yOffset][x + xOffset]) return true;
+			auto enemy = color == WHITE_INDEX ? BLACK_INDEX : WHITE_INDEX;
+
+			// Von gegnerischen Bauern angegriffene Felder gegebenenfalls nicht als Bewegungsmglichkeit zhlen
+			auto targets = ~pieces[color];
+			if (PIECE_MOBILITY_EXCLUDE_PAWN_ATTACKS) targets &= ~bitboard::PAWN_ATTACKS(enemy, position.getBitboard(enemy, PAWN_INDEX));
+
+			// Bauern: Einzel- und Doppelschritte auf leere Felder sowie Schlagzge
+			auto pawns = position.getBitboard(color, PAWN_INDEX);
+			auto single_push = bitboard::SHIFT_FORWARD(color, pawns) & ~occupied;
+			auto double_push_row = bitboard::ROW(color == WHITE_INDEX ? PAWN_DOUBLE_MOVE_START_WHITE_Y + PAWN_DIRECTION_WHITE : PAWN_DOUBLE_MOVE_START_BLACK_Y + PAWN_DIRECTION_BLACK);
+			auto double_push = bitboard::SHIFT_FORWARD(color, single_push & double_push_row) & ~occupied;
+			auto pawn_forward = bitboard::SHIFT_FORWARD(color, pawns);
+
+			possibleMoves[color][PAWN_INDEX] += bitboard::POP_COUNT(single_push) + bitboard::POP_COUNT(double_push)
+				+ bitboard::POP_COUNT(bitboard::SHIFT_EAST(pawn_forward) & pieces[enemy])
+				+ bitboard::POP_COUNT(bitboard::SHIFT_WEST(pawn_forward) & pieces[enemy]);
+
+			// Springer, Lufer, Turm und Dame: Angriffsfelder ohne eigene Figuren
+			for (auto knights = position.getBitboard(color, KNIGHT_INDEX); knights; )
+				possibleMoves[color][KNIGHT_INDEX] += bitboard::POP_COUNT(bitboard::KNIGHT_ATTACKS[bitboard::POP_LSB(knights)] & targets);
+
+			for (auto bishops = position.getBitboard(color, BISHOP_INDEX); bishops; )
+				possibleMoves[color][BISHOP_INDEX] += bitboard::POP_COUNT(bitboard::BISHOP_ATTACKS(bitboard::POP_LSB(bishops), occupied) & targets);
+
+			for (auto rooks = position.getBitboard(color, ROOK_INDEX); rooks; )
+				possibleMoves[color][ROOK_INDEX] += bitboard::POP_COUNT(bitboard::ROOK_ATTACKS(bitboard::POP_LSB(rooks), occupied) & targets);
+
+			for (auto queens = position.getBitboard(color, QUEEN_INDEX); queens; )
+			{
+				auto square = bitboard::POP_LSB(queens);
+				possibleMoves[color][QUEEN_INDEX] += bitboard::POP_COUNT((bitboard::BISHOP_ATTACKS(square, occupied) | bitboard::ROOK_ATTACKS(square, occupied)) & targets);
+			}
+
+			// Knig: Nachbarfelder ohne eigene Figuren (Rochade wird nicht bercksichtigt)
+			for (auto kings = position.getBitboard(color, KING_INDEX); kings; )
+				possibleMoves[color][KING_INDEX] += bitboard::POP_COUNT(bitboard::KING_ATTACKS[bitboard::POP_LSB(kings)] & ~pieces[color]);
 		}
+	}
+
+	VOID ChessEvaluation::evaluatePawnStructure(const Position& position, PawnHashEntry& entry)
+	{
+		for (INT32 color = FIRST_PLAYER_INDEX; color < PLAYER_COUNT; color++)
+		{
+			auto enemy = color == WHITE_INDEX ? BLACK_INDEX : WHITE_INDEX;
+			auto pawns = position.getBitboard(color, PAWN_INDEX);
+			auto enemy_pawns = position.getBitboard(enemy, PAWN_INDEX);
+
+			// Eigener Bauer auf der gleichen Linie davor oder dahinter
+			auto doubled = pawns & (bitboard::FRONT_SPAN(color, pawns) | bitboard::FRONT_SPAN(enemy, pawns));
+			// Eigener Bauer direkt daneben
+			auto connected = pawns & (bitboard::SHIFT_EAST(pawns) | bitboard::SHIFT_WEST(pawns));
+			// Bauer deckt einen eigenen Bauern oder wird von einem eigenen Bauern gedeckt
+			auto chain = pawns & (bitboard::PAWN_ATTACKS(color, pawns) | bitboard::PAWN_ATTACKS(enemy, pawns));
+			// Kein eigener Bauer auf den Nachbarlinien
+			auto pawn_files = bitboard::FILL_FILE(pawns);
+			auto isolated = pawns & ~(bitboard::SHIFT_EAST(pawn_files) | bitboard::SHIFT_WEST(pawn_files));
+			// Kein gegnerischer Bauer vor dem Bauern auf der gleichen Linie oder den Nachbarlinien
+			auto enemy_span = bitboard::FRONT_SPAN(enemy, enemy_pawns);
+			auto passed = pawns & ~(enemy_span | bitboard::SHIFT_EAST(enemy_span) | bitboard::SHIFT_WEST(enemy_span));
+			// Kein eigener Bauer auf den Nachbarlinien auf gleicher Hhe oder dahinter und das Feld vor dem Bauern wird von einem gegnerischen Bauern angegriffen
+			auto support = bitboard::FILL_FORWARD(color, pawns);
+			auto supportable = bitboard::SHIFT_EAST(support) | bitboard::SHIFT_WEST(support);
+			auto backwards = pawns & ~supportable & bitboard::SHIFT_BACKWARD(color, bitboard::PAWN_ATTACKS(enemy, enemy_pawns));
+
+			auto isolated_double = doubled & isolated;
+			auto connected_passed = connected & passed;
+
+			auto& score = entry.score[color];
+
+			score += bitboard::POP_COUNT(doubled)		* PAWN_STRUCTURE_DOUBLE_PAWNS_PENALTY * PAWN_STRUCTURE_WEIGHT;
+			score += bitboard::POP_COUNT(connected)		* PAWN_STRUCTURE_CONNECTED_PAWNS_BONUS * PAWN_STRUCTURE_WEIGHT;
+			score += bitboard::POP_COUNT(chain)			* PAWN_STRUCTURE_CHAIN_PAWNS_BONUS * PAWN_STRUCTURE_WEIGHT;
+			score += bitboard::POP_COUNT(passed)		* PAWN_STRUCTURE_PASSED_PAWNS_BONUS * PAWN_STRUCTURE_WEIGHT;
+
+			score += bitboard::POP_COUNT(isolated)		* PAWN_STRUCTURE_ISOLATED_PAWNS_PENALTY * PAWN_STRUCTURE_WEIGHT;
+			score += bitboard::POP_COUNT(backwards)		* PAWN_STRUCTURE_BACKWARDS_PAWNS_PENALTY * PAWN_STRUCTURE_WEIGHT;
+
+			score += bitboard::POP_COUNT(isolated_double) * PAWN_STRUCTURE_ISOLATED_DOUBLE_PAWNS_PENALTY * PAWN_STRUCTURE_WEIGHT;
+			score += bitboard::POP_COUNT(connected_passed) * PAWN_STRUCTURE_CONNECTED_PASSED_PAWNS_BONUS * PAWN_STRUCTURE_WEIGHT;
+
+			// Fortschrittsbonus der Freibauern je nach Entfernung zur gegnerischen Grundreihe
+			for (auto remaining = passed; remaining; )
+			{
+				auto y = bitboard::POP_LSB(remaining) / COLUMNS;
+				auto passed_progress_index = color == WHITE_INDEX ? LAST_ROW_INDEX - y : y;
+				score += PASSED_PAWNS_PROGRESS_BONUS[passed_progress_index] * PAWN_STRUCTURE_WEIGHT;
+			}
 
-		return false;
+			entry.passed[color] = passed;
+			entry.isolated[color] = isolated;
+		}
 	}
+
 	INT32 ChessEvaluation::GetPlayerIndexByPositionPlayer(INT32 currentPlayerOfPosition)
 	{
 		return currentPlayerOfPosition == PLAYER_WHITE ? WHITE_INDEX : BLACK_INDEX;
@@ -363,4 +553,9 @@ namespace owl
 		auto&& enemy_color = GetPlayerIndexByPositionPlayer(-currentPlayerOfPosition);
 		return PIECES[enemy_color][pieceIndex];
 	}
+
+	// Explizite Instanziierungen der hufigen Feature-Kombinationen
+	template EVALUATION_VALUE ChessEvaluation::evaluate<EVAL_FT_STANDARD>(Position& position, INT32 enginePlayer, BOOL validationCheckMate);
+	template EVALUATION_VALUE ChessEvaluation::evaluate<EVAL_FT_NULL>(Position& position, INT32 enginePlayer, BOOL validationCheckMate);
+	template EVALUATION_VALUE ChessEvaluation::evaluate<EVAL_FT_STANDARD>(Position& position, INT32 enginePlayer, EVALUATION_VALUE alpha, EVALUATION_VALUE beta, BOOL validationCheckMate);
 }
@@ -3,6 +3,8 @@
 #include "defines.hpp"
 #include <array>
 #include "Position.hpp"
+#include "PawnHashTable.hpp"
+#include "EvaluationCache.hpp"
 
 namespace owl
 {
@@ -13,83 +15,115 @@ namespace owl
 	{
 	public:
 		/**
-		 * Bewertungsfunktion
+		 * Bewertungsfunktion mit Feature-Parametern zur Laufzeit. Fr EVAL_FT_STANDARD und EVAL_FT_NULL
+		 * wird an die spezialisierte Instanz von evaluate<Flags>() weitergeleitet.
 		 * 
 		 * \param position Ausgangstellung bzw. Position, die bewertet werden soll
 		 * \param enginePlayer Der Spieler (Wei/Schwarz), welcher von der Schach-Engine gespielt wird
 		 * \param evaluationFeatureFlags Feature-Parameter-Flags fr die Komponenten der Bewertungsfunktion, die mit EVAL_FT_* beginnen
 		 * \param validationCheckMate Ob Checkmate berprfung stattfinden sol
-		 * \return Nutzwert der Bewertungsfunktion
+		 * \return Nutzwert der Bewertungsfunktion in Centipawns (+/-MATE_VALUE fr Mattstellungen)
 		 */
 		static EVALUATION_VALUE evaluate(Position& position, INT32 enginePlayer, UCHAR evaluationFeatureFlags = 0, BOOL validationCheckMate = false);
-	private:
 		/**
-		 * Doppelte Bauernstruktur gefunden?
+		 * Bewertungsfunktion mit Feature-Parametern zur Laufzeit und Suchfenster (Lazy Evaluation, siehe evaluate<Flags>() mit Fenster).
+		 * Fr EVAL_FT_STANDARD wird an die spezialisierte Instanz weitergeleitet.
 		 * 
-		 * \param position Ausgangsstellung
-		 * \param x Spalte
-		 * \param y Reihe
-		 * \return Eigenschaft zutreffend?
+		 * \param position Position, die bewertet werden soll
+		 * \param enginePlayer Der Spieler (Wei/Schwarz), welcher von der Schach-Engine gespielt wird
+		 * \param evaluationFeatureFlags Feature-Parameter-Flags fr die Komponenten der Bewertungsfunktion, die mit EVAL_FT_* beginnen
+		 * \param alpha Untere Grenze des Fensters aus Sicht von enginePlayer
+		 * \param beta Obere Grenze des Fensters aus Sicht von enginePlayer
+		 * \param validationCheckMate Ob Checkmate berprfung stattfinden sol
+		 * \return Nutzwert in Centipawns, exakt nur innerhalb von (alpha, beta)
 		 */
-		static BOOL isDoublePawn(const Position& position, INT32 x, INT32 y);
+		static EVALUATION_VALUE evaluate(Position& position, INT32 enginePlayer, UCHAR evaluationFeatureFlags,
+			EVALUATION_VALUE alpha, EVALUATION_VALUE beta, BOOL validationCheckMate = false);
 		/**
-		 * Verbunden Bauernstruktur gefunden?
-		 *
-		 * \param position Ausgangsstellung
-		 * \param x Spalte
-		 * \param y Reihe
-		 * \return Eigenschaft zutreffend?
+		 * Bewertungsfunktion mit Feature-Parametern zur Kompilierzeit (ohne Abfragen der Features).
+		 * Explizit instanziiert fr EVAL_FT_STANDARD und EVAL_FT_NULL.
+		 * 
+		 * \tparam Flags Feature-Parameter-Flags, die mit EVAL_FT_* beginnen
+		 * \param position Position, die bewertet werden soll
+		 * \param enginePlayer Der Spieler (Wei/Schwarz), welcher von der Schach-Engine gespielt wird
+		 * \param validationCheckMate Ob Checkmate berprfung stattfinden sol
+		 * \return Nutzwert der Bewertungsfunktion in Centipawns (+/-MATE_VALUE fr Mattstellungen)
 		 */
-		static BOOL isConnectedPawn(const Position& position, INT32 x, INT32 y);
+		template <INT32 Flags>
+		static EVALUATION_VALUE evaluate(Position& position, INT32 enginePlayer, BOOL validationCheckMate = false);
 		/**
-		 * Rcklufige Bauernstruktur gefunden?
-		 *
-		 * \param position Ausgangsstellung
-		 * \param x Spalte
-		 * \param y Reihe
-		 * \return Eigenschaft zutreffend?
+		 * Bewertungsfunktion mit Suchfenster (Lazy Evaluation): Zuerst werden die gnstigen Komponenten berechnet.
+		 * Liegt deren Summe auch mit den grtmglichen Beitrgen von Bauernstruktur und Mobilitt (PIECE_MOBILITY_MAX,
+		 * PAWN_STRUCTURE_MAX_BONUS, PAWN_STRUCTURE_MAX_PENALTY) auerhalb des Fensters,
+		 * wird nur eine Schranke auerhalb des Fensters zurckgegeben. Explizit instanziiert fr EVAL_FT_STANDARD.
+		 * 
+		 * \tparam Flags Feature-Parameter-Flags, die mit EVAL_FT_* beginnen
+		 * \param position Position, die bewertet werden soll
+		 * \param enginePlayer Der Spieler (Wei/Schwarz), welcher von der Schach-Engine gespielt wird
+		 * \param alpha Untere Grenze des Fensters aus Sicht von enginePlayer
+		 * \param beta Obere Grenze des Fensters aus Sicht von enginePlayer
+		 * \param validationCheckMate Ob Checkmate berprfung stattfinden sol
+		 * \return Nutzwert in Centipawns, exakt nur innerhalb von (alpha, beta)
 		 */
-		static BOOL isBackwardsPawn(const Position& position, INT32 x, INT32 y);
+		template <INT32 Flags>
+		static EVALUATION_VALUE evaluate(Position& position, INT32 enginePlayer, EVALUATION_VALUE alpha, EVALUATION_VALUE beta, BOOL validationCheckMate = false);
 		/**
-		 * Freiebauern gefunden?
-		 *
-		 * \param position Ausgangsstellung
-		 * \param x Spalte
-		 * \param y Reihe
-		 * \return Eigenschaft zutreffend?
+		 * Bewertungsfunktion mit Aufschlsselung in die einzelnen Komponenten (z.B. fr den UCI-Befehl "eval").
+		 * Endstellungen werden nicht erkannt und der Zwischenspeicher wird nicht verwendet.
+		 * 
+		 * \param position Position, die bewertet werden soll
+		 * \param enginePlayer Spieler, aus dessen Sicht bewertet wird
+		 * \param evaluationFeatureFlags Feature-Parameter-Flags fr die Komponenten der Bewertungsfunktion, die mit EVAL_FT_* beginnen
+		 * \return Bewertung je Komponente in Bauerneinheiten
 		 */
-		static BOOL isPassedPawn(const Position& position, INT32 x, INT32 y);
+		static EvaluationDataScore trace(const Position& position, INT32 enginePlayer, UCHAR evaluationFeatureFlags = 0);
+	private:
 		/**
-		 * Verkettete Bauernstruktur gefunden?
-		 *
-		 * \param position Ausgangsstellung
-		 * \param x Spalte
-		 * \param y Reihe
-		 * \return Eigenschaft zutreffend?
+		 * Endstellungen erkennen, Zwischenspeicher abfragen und die Stellung bewerten.
+		 * 
+		 * \tparam Flags Feature-Parameter-Flags oder FT_RUNTIME
+		 * \param position Position, die bewertet werden soll
+		 * \param enginePlayer Spieler, aus dessen Sicht bewertet wird
+		 * \param evaluationFeatureFlags Feature-Parameter-Flags (nur fr FT_RUNTIME verwendet)
+		 * \param alpha Untere Grenze des Fensters (-INF: keine Lazy Evaluation)
+		 * \param beta Obere Grenze des Fensters (INF: keine Lazy Evaluation)
+		 * \param validationCheckMate Ob Checkmate berprfung stattfinden sol
+		 * \return Nutzwert der Bewertungsfunktion in Centipawns
 		 */
-		static BOOL isChainPawn(const Position& position, INT32 x, INT32 y);
+		template <INT32 Flags>
+		static EVALUATION_VALUE evaluateFeatures(Position& position, INT32 enginePlayer, UCHAR evaluationFeatureFlags,
+			EVALUATION_VALUE alpha, EVALUATION_VALUE beta, BOOL validationCheckMate);
 		/**
-		 * Hilfsfunktion zur berprfung, ob sich ein freundlicher Bauer bei der Position x+xOffset, y+yOffset befindet
+		 * Alle Komponenten der Bewertungsfunktion berechnen.
 		 * 
-		 * \param position Stellung
-		 * \param x Spalte
-		 * \param y Zeile
-		 * \param xOffset Offset fr die Spalte
-		 * \param yOffset Offsest fr die Zeile
-		 * \return Eigenschaft zutreffend?
+		 * \tparam Flags Feature-Parameter-Flags oder FT_RUNTIME
+		 * \param position Position, die bewertet werden soll
+		 * \param enginePlayer Spieler, aus dessen Sicht bewertet wird
+		 * \param evaluationFeatureFlags Feature-Parameter-Flags (nur fr FT_RUNTIME verwendet)
+		 * \param alpha Untere Grenze des Fensters in Centipawns
+		 * \param beta Obere Grenze des Fensters in Centipawns
+		 * \param exact Wird auf false gesetzt, wenn nur eine Schranke der Lazy Evaluation zurckgegeben wird
+		 * \param trace Aufschlsselung, die befllt wird (nullptr in der Suche)
+		 * \return Bewertung in Bauerneinheiten
 		 */
-		static BOOL isPawnPieceAlliedOnOffset(const Position& position, INT32 x, INT32 y, INT32 xOffset, INT32 yOffset);
+		template <INT32 Flags>
+		static FLOAT evaluateTerms(const Position& position, INT32 enginePlayer, UCHAR evaluationFeatureFlags,
+			EVALUATION_VALUE alpha, EVALUATION_VALUE beta, BOOL& exact, EvaluationDataScore* trace);
 		/**
-		 * Hilfsfunktion zur berprfung, ob sich ein feindlicher Bauer bei der Position x+xOffset, y+yOffset befindet
+		 * Bauernstruktur beider Spieler bewerten und Freibauern und isolierte Bauern bestimmen.
 		 * 
-		 * \param position Stellung
-		 * \param x Spalte
-		 * \param y Zeile
-		 * \param xOffset Offset fr die Spalte
-		 * \param yOffset Offset fr die Zeile
-		 * \return Eigenschaft zutreffend?
+		 * \param position Ausgangsstellung
+		 * \param entry Eintrag fr die Bauern-Hash-Tabelle, der befllt wird
 		 */
-		static BOOL isPawnPieceHostileOnOffset(const Position& position, INT32 x, INT32 y, INT32 xOffset, INT32 yOffset);
+		static VOID evaluatePawnStructure(const Position& position, PawnHashEntry& entry);
+		/**
+		 * Bewegungsmglichkeiten aller Figuren aus den Angriffsfeldern zhlen (Piece Mobility).
+		 * Es werden pseudolegale Zge gezhlt, d.h. ohne berprfung auf Schach.
+		 * 
+		 * \param position Ausgangsstellung
+		 * \param possibleMoves Anzahl der Bewegungsmglichkeiten pro Spieler und Figurentyp, die erhht wird
+		 */
+		static VOID countMobility(const Position& position, INT32 (&possibleMoves)[PLAYER_COUNT][MAX_PIECE_TYPES]);
 	public:
 		/**
 		 * Gebe den Spielerindex zum korrespondierenden aktuellen Spieler zurck
@@ -106,5 +140,63 @@ namespace owl
 		 * \return Figur
 		 */
 		static UCHAR GetEnemyPiece(INT32 currentPlayerOfPosition, INT32 pieceIndex);
+		/**
+		 * Static Exchange Evaluation: Materialbilanz der vollstndigen Schlagabfolge auf dem Zielfeld eines Zugs,
+		 * wobei beide Seiten jeweils mit der geringwertigsten Figur schlagen und jederzeit aufhren drfen.
+		 * Figuren hinter dem Schlagenden (Rntgenangriffe) werden bercksichtigt, Fesselungen nicht.
+		 * 
+		 * \param position Stellung vor dem Zug
+		 * \param move Zug (in der Regel ein Schlagzug)
+		 * \return Materialgewinn fr den ziehenden Spieler in Centipawns (siehe SEE_VALUES)
+		 */
+		static EVALUATION_VALUE staticExchangeEvaluation(const Position& position, const Move& move);
+		/**
+		 * Alle Figuren beider Spieler, die ein Feld angreifen.
+		 * 
+		 * \param position Stellung
+		 * \param square Feld (y * COLUMNS + x)
+		 * \param occupied Besetzte Felder (fr Langschrittler, z.B. ohne bereits geschlagene Figuren)
+		 * \return Bitboard der Angreifer
+		 */
+		static BITBOARD getAttackers(const Position& position, INT32 square, BITBOARD occupied);
+		/**
+		 * Kontinuierliche Spielphase aus dem Material ohne Bauern.
+		 * 
+		 * \param position Stellung
+		 * \return Spielphase zwischen PHASE_END_GAME (0.0) und PHASE_MID_GAME (1.0)
+		 */
+		static FLOAT getPhase(const Position& position);
+		/**
+		 * Mittel- und Endspielwert entsprechend der Spielphase interpolieren.
+		 * 
+		 * \param midGame Wert im Mittelspiel
+		 * \param endGame Wert im Endspiel
+		 * \param phase Spielphase (siehe getPhase())
+		 * \return Interpolierter Wert
+		 */
+		static FLOAT taper(FLOAT midGame, FLOAT endGame, FLOAT phase);
+		/**
+		 * Hash-Tabelle der Bauernstruktur, die von evaluate() im aufrufenden Thread verwendet wird (siehe bindCaches()).
+		 * 
+		 * \return Bauern-Hash-Tabelle des aufrufenden Threads
+		 */
+		static PawnHashTable& getPawnHashTable();
+		/**
+		 * Zwischenspeicher der Bewertungsfunktion, der von evaluate() im aufrufenden Thread verwendet wird (siehe bindCaches()).
+		 * 
+		 * \return Bewertungs-Zwischenspeicher des aufrufenden Threads
+		 */
+		static EvaluationCache& getEvaluationCache();
+		/**
+		 * Zwischenspeicher festlegen, die evaluate() im aufrufenden Thread verwendet (z.B. die Tabellen einer Engine in ihrem Such-Thread).
+		 * Ohne Festlegung besitzt jeder Thread eigene Zwischenspeicher.
+		 * 
+		 * \param evaluationCache Bewertungs-Zwischenspeicher (nullptr: eigener Zwischenspeicher des Threads)
+		 * \param pawnHashTable Bauern-Hash-Tabelle (nullptr: eigene Tabelle des Threads)
+		 */
+		static VOID bindCaches(EvaluationCache* evaluationCache, PawnHashTable* pawnHashTable);
+	private:
+		static thread_local EvaluationCache* s_evaluationCache; // Mit bindCaches() festgelegter Bewertungs-Zwischenspeicher (je Thread)
+		static thread_local PawnHashTable* s_pawnHashTable; // Mit bindCaches() festgelegte Bauern-Hash-Tabelle (je Thread)
 	};
 }
\ No newline at end of file
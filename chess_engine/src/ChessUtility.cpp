@@ -82,7 +82,7 @@ namespace owl {
         if (en_passant)
         {
             en_passant_pos.first    = passant_pos_str[0] - 'a';
-            en_passant_pos.second   = 7 - passant_pos_str[1] - '1';
+            en_passant_pos.second   = 7 - (passant_pos_str[1] - '1');
         }
 
         // Halbzge
@@ -166,15 +166,15 @@ namespace owl {
         // capture vom String abfragen:
         move.capture = algebraicNotation.find("x") != std::string::npos;
 
-        // promotion vom String abfragen:
-        move.promotion = algebraicNotation.size() == 6 ? algebraicNotation[5] : 0;
-
         // position setzen
         move.startX = algebraicNotation[0] - 'a';
         move.startY = 7 - (algebraicNotation[1] - '1');
 
         INT32 index_offset = (algebraicNotation[2] >= 'a' && algebraicNotation[2] <= 'h') ? 0 : 1;
 
+        // promotion vom String abfragen (z.B. "e7e8q" oder "e7-e8q"):
+        move.promotion = algebraicNotation.size() == 5 + index_offset ? algebraicNotation[4 + index_offset] : 0;
+
         move.targetX = algebraicNotation[2+index_offset] - 'a';
         move.targetY = 7 - (algebraicNotation[3+index_offset] - '1');
 
@@ -226,12 +226,12 @@ namespace owl {
         out += '8' - move.targetY;
 
         // promotion
-        out += move.promotion;
+        if (move.promotion > 0) out += move.promotion;
 
         return out;
     }
     INT32 ChessUtility::convertToCentipawns(FLOAT VALUE)
     {
-        return static_cast<INT32>(std::round(VALUE*100.f));
+        return static_cast<INT32>(std::round(VALUE*CENTIPAWNS_PER_PAWN));
     }
 }
@@ -8,7 +8,7 @@
 
 namespace owl
 {
-	MOVE_LIST ChessValidation::s_data = MOVE_LIST();
+	thread_local MOVE_LIST ChessValidation::s_data = MOVE_LIST();
 
 	VOID ChessValidation::init()
 	{
@@ -66,6 +66,43 @@ namespace owl
 
 		return s_data;
 	}
+	BOOL ChessValidation::hasLegalMove(Position& position, INT32 player)
+	{
+		s_data.clear();
+
+		// Knig zuerst
+		auto index = ChessEvaluation::GetPlayerIndexByPositionPlayer(player);
+		auto [king_x, king_y] = position.getKingPosition(index);
+
+		getValidKingMoves(position, king_x, king_y, player, false);
+		if (!s_data.empty()) return true;
+
+		for (INT32 y = FIRST_ROW_INDEX; y < ROWS; y++)
+		{
+			for (INT32 x = FIRST_COLUMN_INDEX; x < COLUMNS; x++)
+			{
+				auto piece = position[y][x];
+				if (piece == EMPTY_FIELD) continue;
+
+				auto piece_color = GET_PLAYER_INDEX_BY_PIECE(piece);
+				if (piece_color != index) continue;
+
+				switch (GET_PIECE_INDEX_BY_TYPE(piece))
+				{
+				case PAWN_INDEX: getValidPawnMoves(position, x, y, player, false); break;
+				case KNIGHT_INDEX: getValidKnightMoves(position, x, y, player, false); break;
+				case ROOK_INDEX: getValidRookMoves(position, x, y, player, false); break;
+				case BISHOP_INDEX: getValidBishopMoves(position, x, y, player, false); break;
+				case QUEEN_INDEX: getValidRookMoves(position, x, y, player, false); getValidBishopMoves(position, x, y, player, false); break;
+				}
+
+				// Erster legaler Zug gefunden
+				if (!s_data.empty()) return true;
+			}
+		}
+
+		return false;
+	}
 	INT32 ChessValidation::countPossibleMovesOnField(Position& position, INT32 x, INT32 y, BOOL noKingCheck)
 	{
 		//MOVE_LIST moves;
@@ -141,7 +178,7 @@ namespace owl
 			{
 				auto place = position[king_y - i][king_x - i];
 				if (place == enemy_queen || place == enemy_bishop) return true;
-				if (place == enemy_king && abs(i - king_x) <= 1 && abs(i - king_y)) return true;
+				if (place == enemy_king && i == 1) return true;
 				else if (place != EMPTY_FIELD) break;
 			}
 		}
@@ -153,7 +190,7 @@ namespace owl
 			{
 				auto place = position[king_y + i][king_x + i];
 				if (place == enemy_queen || place == enemy_bishop) return true;
-				if (place == enemy_king && abs(i - king_x) <= 1 && abs(i - king_y)) return true;
+				if (place == enemy_king && i == 1) return true;
 				if (place != EMPTY_FIELD) break;
 			}
 		}
@@ -165,7 +202,7 @@ namespace owl
 			{
 				auto place = position[king_y - i][king_x + i];
 				if (place == enemy_queen || place == enemy_bishop) return true;
-				if (place == enemy_king && abs(i - king_x) <= 1 && abs(i - king_y)) return true;
+				if (place == enemy_king && i == 1) return true;
 				if (place != EMPTY_FIELD) break;
 			}
 		}
@@ -177,7 +214,7 @@ namespace owl
 			{
 				auto place = position[king_y + i][king_x - i];
 				if (place == enemy_queen || place == enemy_bishop) return true;
-				if (place == enemy_king && abs(i - king_x) <= 1 && abs(i - king_y)) return true;
+				if (place == enemy_king && i == 1) return true;
 				if (place != EMPTY_FIELD) break;
 			}
 		}
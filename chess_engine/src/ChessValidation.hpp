@@ -24,6 +24,15 @@ namespace owl
 		 * \return Liste der mglichen bzw. gltigen Zge
 		 */
 		static MOVE_LIST getValidMoves(Position& position, INT32 player);
+		/**
+		 * Hat der Spieler mindestens einen legalen Zug? Bricht nach der ersten Figur mit einem legalen Zug ab
+		 * und untersucht zuerst den Knig (im Schach am hufigsten der einzige Ausweg).
+		 * 
+		 * \param position Stellung
+		 * \param player Spieler
+		 * \return Zutreffend?
+		 */
+		static BOOL hasLegalMove(Position& position, INT32 player);
 		/**
 		 * Funktion zur Ermittlung der Anzahl gltiger Zge zu einer bestimmten Position. Wird fr die Piece-Mobilty verwendet.
 		 * 
@@ -62,7 +71,7 @@ namespace owl
 		 */
 		static BOOL isInsideChessboard(INT32 x, INT32 y);
 	private: 
-		static MOVE_LIST s_data; // Liste fr die Zwischenspeicherung der validen Zge
+		static thread_local MOVE_LIST s_data; // Liste fr die Zwischenspeicherung der validen Zge (je Thread)
 		/**
 		 * Ist die Platzierung von x und y "im Schach" bzw. wird diese Position bedroht? 
 		 * 
@@ -27,6 +27,9 @@ namespace owl
             EVALUATE,
             GETVALIDMOVES,
             UCINEWGAME,
+            BITBASES,
+            BENCH,
+            STATS,
             INVALID
         };
 
@@ -7,20 +7,23 @@ namespace owl
     /**
      * Regex-Liste zur Filterung der UCI-Befehle.
      */
-    const std::array<const std::string, 13U> COMMAND_VALIDATION_MAP = {
+    const std::array<const std::string, 16U> COMMAND_VALIDATION_MAP = {
         "^uci$",
         "^debug (on|off)$",
         "^isready$",
         "^setoption name (.*?)(?:\\svalue (.+))?$",
         "^position (startpos|(?:[knprqbKNPRQB1-8\\/]+ [wb] [KQkq\\-]{1,4} [a-h1-8\\-]{1,2} \\d+ \\d+)) moves ((?:[a-h0-8xqbrnQBRN\\+\\-]{4,7}\\s?)*)",
         "^quit$",
-        "^go(?: (?:(infinite)|(searchmoves (?:[a-h0-8x\\+]{4,6}\\s?)+)|(ponder)|(wtime \\d+)|(btime \\d+)|(winc -?\\d+)|(binc -?\\d+)|(movestogo \\d+)|(depth \\d+)|(nodes \\d+)|(mate \\d+)|(movetime \\d+)|(infinite)))+$",
+        "^go(?: (?:(infinite)|(searchmoves (?:[a-h0-8xqrnQRN\\+\\-]{4,7}\\s?)+)|(ponder)|(wtime \\d+)|(btime \\d+)|(winc -?\\d+)|(binc -?\\d+)|(movestogo \\d+)|(depth \\d+)|(nodes \\d+)|(mate \\d+)|(movetime \\d+)|(infinite)))+$",
         "^stop$",
         "^ponderhit$",
         "^register (later)|(?:(name .*(?= code))? (code .*)?)$",
         "^evaluate$",
         "^getvalidmoves$",
-        "^ucinewgame$"
+        "^ucinewgame$",
+        "^bitbases$",
+        "^bench(?: (\\d+))?(?: (\\d+))?(?: (\\d+))?$",
+        "^stats$"
     };
     Command CommandBuilder::build(const std::string& command_str)
     {
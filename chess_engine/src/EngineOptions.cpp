@@ -40,12 +40,17 @@ namespace owl
             execute a move out of its book for the engine. If this is set to false by the GUI,
             the engine should not access its own book.
         */
-        m_engineOptions["OwnBook"] = { false, "", "", "check" };
+        m_engineOptions["OwnBook"] = { true, "", "false", "check" };
+
+        /*
+            this is the path to the opening book of the engine in the Polyglot format (*.bin), used if "OwnBook" is set.
+        */
+        m_engineOptions["BookFile"] = { true, "", "<empty>", "string" };
 
         /*
             the engine supports multi best line or k-best mode. the default value is 1
         */
-        m_engineOptions["MultiPV"] = { false, "", "1", "spin" };
+        m_engineOptions["MultiPV"] = { true, "", "1 min 1 max 64", "spin" };
 
         /*
             the engine can show the current line it is calculating. see "info currline" above.
@@ -111,6 +116,11 @@ namespace owl
         */
         m_engineOptions["Nullmove"] = { true, "", "true", "check" };
 
+        /*
+            the engine appends the search statistics (see the "stats" command) as "info string" after every search
+        */
+        m_engineOptions["SearchStatistics"] = { true, "", "false", "check" };
+
         /*
             the playstyle of the engine (aggressive or passive etc)
         */
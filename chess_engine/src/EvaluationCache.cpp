@@ -0,0 +1,51 @@
+#include "EvaluationCache.hpp"
+
+namespace owl
+{
+	UINT64 EvaluationCache::getKey(const Position& position, INT32 enginePlayer, UCHAR evaluationFeatureFlags)
+	{
+		// Parameter in die oberen Bits mischen, die Stellung selbst ist bereits durch den Zobrist-Schlssel bestimmt
+		UINT64 parameters = static_cast<UINT64>(evaluationFeatureFlags)
+			| static_cast<UINT64>(enginePlayer == PLAYER_BLACK) << 8;
+
+		return position.getKey() ^ (parameters * 0x9E3779B97F4A7C15ULL);
+	}
+	const EvaluationCacheEntry* EvaluationCache::probe(UINT64 key)
+	{
+		if (!m_enabled) return nullptr;
+
+		m_probes++;
+
+		const auto& entry = m_data[key & (EVALUATION_CACHE_SIZE - 1)];
+		if (!entry.valid || entry.key != key) return nullptr;
+
+		m_hits++;
+		return &entry;
+	}
+	VOID EvaluationCache::store(const EvaluationCacheEntry& entry)
+	{
+		if (!m_enabled) return;
+
+		auto& target = m_data[entry.key & (EVALUATION_CACHE_SIZE - 1)];
+		target = entry;
+		target.valid = true;
+	}
+	VOID EvaluationCache::clear()
+	{
+		for (auto& entry : m_data) entry.valid = false;
+		m_probes = 0;
+		m_hits = 0;
+	}
+	VOID EvaluationCache::setEnabled(BOOL enabled)
+	{
+		m_enabled = enabled;
+	}
+	INT64 EvaluationCache::getProbes() const
+	{
+		return m_probes;
+	}
+	INT64 EvaluationCache::getHits() const
+	{
+		return m_hits;
+	}
+}
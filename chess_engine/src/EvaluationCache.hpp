@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+
+#include "defines.hpp"
+#include "Position.hpp"
+
+namespace owl
+{
+	constexpr INT32 EVALUATION_CACHE_SIZE = 1 << 15; // Anzahl der Eintrge (Zweierpotenz)
+
+	/**
+	 * Zwischengespeicherte Bewertung einer Stellung.
+	 */
+	struct EvaluationCacheEntry
+	{
+		UINT64 key = 0; // Schlssel aus Stellung, Feature-Flags und Spieler (siehe EvaluationCache::getKey())
+		BOOL valid = false; // Eintrag belegt?
+		EVALUATION_VALUE score; // Bewertung aus Sicht des Spielers
+	};
+
+	/**
+	 * Direkt adressierter Zwischenspeicher fr die Bewertungsfunktion.
+	 * Dieselben Stellungen werden in der Suche mehrfach bewertet (Zugumstellungen, Zugsortierung nach Material).
+	 * Kollisionen werden durch Ersetzen des Eintrags aufgelst.
+	 */
+	class EvaluationCache
+	{
+	public:
+		/**
+		 * Schlssel fr eine Bewertung bilden. Neben der Stellung flieen alle Parameter ein,
+		 * von denen das Ergebnis der Bewertung abhngt.
+		 * 
+		 * \param position Zu bewertende Stellung
+		 * \param enginePlayer Spieler, aus dessen Sicht bewertet wird
+		 * \param evaluationFeatureFlags Feature-Parameter-Flags der Bewertung
+		 * \return Schlssel
+		 */
+		static UINT64 getKey(const Position& position, INT32 enginePlayer, UCHAR evaluationFeatureFlags);
+		/**
+		 * Eintrag zu einem Schlssel suchen.
+		 * 
+		 * \param key Schlssel (siehe getKey())
+		 * \return Gefundener Eintrag oder nullptr
+		 */
+		const EvaluationCacheEntry* probe(UINT64 key);
+		/**
+		 * Eintrag speichern. Ein vorhandener Eintrag am gleichen Index wird berschrieben.
+		 * 
+		 * \param entry Zu speichernder Eintrag
+		 */
+		VOID store(const EvaluationCacheEntry& entry);
+		/**
+		 * Alle Eintrge entfernen.
+		 */
+		VOID clear();
+		/**
+		 * Zwischenspeicher ein- oder ausschalten. Ausgeschaltet findet probe() nichts und store() speichert nichts
+		 * (z.B. um die Kosten der Bewertungsfunktion selbst zu messen).
+		 * 
+		 * \param enabled Eingeschaltet?
+		 */
+		VOID setEnabled(BOOL enabled);
+		/**
+		 * Anzahl der Abfragen seit dem letzten clear().
+		 */
+		INT64 getProbes() const;
+		/**
+		 * Anzahl der Treffer seit dem letzten clear().
+		 */
+		INT64 getHits() const;
+	private:
+		std::array<EvaluationCacheEntry, EVALUATION_CACHE_SIZE> m_data = {}; // Eintrge
+		INT64 m_probes = 0; // Anzahl der Abfragen
+		INT64 m_hits = 0; // Anzahl der Treffer
+		BOOL m_enabled = true; // Eingeschaltet?
+	};
+}
@@ -17,7 +17,8 @@ namespace owl
         m_isRunning = true;
         while (m_isRunning) {
             std::string input;
-            std::getline(std::cin, input);
+            // end of input stream: quit instead of spinning on an empty line
+            if (!std::getline(std::cin, input)) input = "quit";
 
             resolveCommand(input);
         }
@@ -6,6 +6,7 @@
 #include "defines.hpp"
 
 #include "ChessEngine.hpp"
+#include "OutputWriter.hpp"
 
 namespace owl
 {
@@ -31,5 +32,6 @@ namespace owl
 		BOOL m_isRunning = false; // Luft die Engine
 		std::shared_ptr<ChessEngine> m_pEngine; // Das Engine-Objekt
 		std::mutex m_mutex; // Mutex zur Thread-Blockierung
+		OutputWriter m_writer; // Ausgabe-Thread fr alle Antworten der Schnittstelle
 	};
 }
\ No newline at end of file
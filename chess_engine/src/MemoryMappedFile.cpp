@@ -0,0 +1,110 @@
+#include "MemoryMappedFile.hpp"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace owl
+{
+	MemoryMappedFile::MemoryMappedFile()
+		: m_data(nullptr), m_size(0)
+#if defined(_WIN32)
+		, m_mapping(nullptr)
+#endif
+	{
+	}
+
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		close();
+	}
+
+	BOOL MemoryMappedFile::open(const std::string& path)
+	{
+		close();
+
+#if defined(_WIN32)
+		auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return false;
+
+		LARGE_INTEGER file_size;
+		if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (!mapping) return false;
+
+		auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!data)
+		{
+			CloseHandle(mapping);
+			return false;
+		}
+
+		m_mapping = mapping;
+		m_data = static_cast<const UCHAR*>(data);
+		m_size = static_cast<size_t>(file_size.QuadPart);
+#else
+		auto file = ::open(path.c_str(), O_RDONLY);
+		if (file == -1) return false;
+
+		struct stat file_stat;
+		if (fstat(file, &file_stat) != 0 || file_stat.st_size <= 0)
+		{
+			::close(file);
+			return false;
+		}
+
+		auto size = static_cast<size_t>(file_stat.st_size);
+		auto data = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+		::close(file);
+		if (data == MAP_FAILED) return false;
+
+		m_data = static_cast<const UCHAR*>(data);
+		m_size = size;
+#endif
+
+		return true;
+	}
+
+	VOID MemoryMappedFile::close()
+	{
+		if (!m_data) return;
+
+#if defined(_WIN32)
+		UnmapViewOfFile(m_data);
+		CloseHandle(m_mapping);
+		m_mapping = nullptr;
+#else
+		munmap(const_cast<UCHAR*>(m_data), m_size);
+#endif
+
+		m_data = nullptr;
+		m_size = 0;
+	}
+
+	BOOL MemoryMappedFile::isOpen() const
+	{
+		return m_data != nullptr;
+	}
+
+	const UCHAR* MemoryMappedFile::getData() const
+	{
+		return m_data;
+	}
+
+	size_t MemoryMappedFile::getSize() const
+	{
+		return m_size;
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <string>
+
+#include "defines.hpp"
+
+namespace owl
+{
+	/**
+	 * Schreibgeschtzt in den Speicher eingeblendete Datei (mmap bzw. MapViewOfFile).
+	 * Das Betriebssystem ldt nur die tatschlich gelesenen Seiten.
+	 */
+	class MemoryMappedFile
+	{
+	public:
+		explicit MemoryMappedFile();
+		virtual ~MemoryMappedFile();
+
+		MemoryMappedFile(const MemoryMappedFile&) = delete;
+		MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+		/**
+		 * Datei einblenden. Eine bereits eingeblendete Datei wird vorher freigegeben.
+		 *
+		 * \param path Dateipfad
+		 * \return Erfolgreich? (Leere Dateien knnen nicht eingeblendet werden)
+		 */
+		BOOL open(const std::string& path);
+		/**
+		 * Eingeblendete Datei freigeben.
+		 */
+		VOID close();
+		/**
+		 * Ist eine Datei eingeblendet?
+		 */
+		BOOL isOpen() const;
+		/**
+		 * Dateiinhalt (nullptr, falls keine Datei eingeblendet ist).
+		 */
+		const UCHAR* getData() const;
+		/**
+		 * Dateigre in Bytes.
+		 */
+		size_t getSize() const;
+	private:
+		const UCHAR* m_data;	// Eingeblendeter Dateiinhalt
+		size_t m_size;			// Dateigre in Bytes
+#if defined(_WIN32)
+		VOID* m_mapping;		// Handle der Dateizuordnung
+#endif
+	};
+}
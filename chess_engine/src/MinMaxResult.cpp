@@ -107,6 +107,8 @@ namespace owl
 	{
 #if OWL_USE_RANDOM==true
 		m_result.clear();
+#else
+		m_best = INVALID_MOVE;
 #endif
 		m_currentBestValue = -INF;
 	}
@@ -0,0 +1,180 @@
+#include "OpeningBook.hpp"
+#include "Bitboard.hpp"
+#include "ChessValidation.hpp"
+#include "ChessUtility.hpp"
+
+#include <cctype>
+#include <random>
+
+namespace owl
+{
+	MemoryMappedFile OpeningBook::s_file;
+
+	BOOL OpeningBook::open(const std::string& path)
+	{
+		close();
+
+		if (path.empty() || path == "<empty>") return false;
+
+		// Schlssel der Startstellung prfen: Nur mit den Standardschlsseln passen die Bcher
+		if (getKey(ChessUtility::fenToPosition(STARTPOS_FEN)) != polyglot::START_POSITION_KEY) return false;
+
+		if (!s_file.open(path)) return false;
+
+		// Ungltige Dateigre?
+		if (s_file.getSize() % polyglot::ENTRY_SIZE != 0)
+		{
+			close();
+			return false;
+		}
+
+		return true;
+	}
+
+	VOID OpeningBook::close()
+	{
+		s_file.close();
+	}
+
+	BOOL OpeningBook::isOpen()
+	{
+		return s_file.isOpen();
+	}
+
+	UINT64 OpeningBook::getKey(const Position& position)
+	{
+		UINT64 key = 0;
+
+		for (INT32 color = FIRST_PLAYER_INDEX; color < PLAYER_COUNT; color++)
+		{
+			for (INT32 type = FIRST_PIECE_TYPES_INDEX; type < MAX_PIECE_TYPES; type++)
+			{
+				// Figurenart: Schwarzer Bauer, weier Bauer, schwarzer Springer, ...
+				auto kind = 2 * type + (color == WHITE_INDEX ? 1 : 0);
+				auto pieces = position.getBitboard(color, type);
+				while (pieces)
+				{
+					auto square = bitboard::POP_LSB(pieces);
+					auto row = LAST_ROW_INDEX - square / COLUMNS;
+					key ^= polyglot::RANDOM64[polyglot::PIECE_OFFSET + 64 * kind + 8 * row + square % COLUMNS];
+				}
+			}
+		}
+
+		if (position.getWhiteCastlingShort()) key ^= polyglot::RANDOM64[polyglot::CASTLING_OFFSET + 0];
+		if (position.getWhiteCastlingLong()) key ^= polyglot::RANDOM64[polyglot::CASTLING_OFFSET + 1];
+		if (position.getBlackCastlingShort()) key ^= polyglot::RANDOM64[polyglot::CASTLING_OFFSET + 2];
+		if (position.getBlackCastlingLong()) key ^= polyglot::RANDOM64[polyglot::CASTLING_OFFSET + 3];
+
+		auto player = position.getPlayer() == PLAYER_WHITE ? WHITE_INDEX : BLACK_INDEX;
+
+		// En Passant nur, wenn ein Bauer des Spielers am Zug tatschlich schlagen kann
+		if (position.isEnPassant())
+		{
+			auto [x, y] = position.getEnPassant();
+			auto capturers = bitboard::PAWN_ATTACKS(1 - player, bitboard::SQUARE(x, y)) & position.getBitboard(player, PAWN_INDEX);
+			if (capturers) key ^= polyglot::RANDOM64[polyglot::EN_PASSANT_OFFSET + x];
+		}
+
+		if (player == WHITE_INDEX) key ^= polyglot::RANDOM64[polyglot::TURN_OFFSET];
+
+		return key;
+	}
+
+	Move OpeningBook::probe(Position& position)
+	{
+		if (!isOpen()) return INVALID_MOVE;
+
+		auto key = getKey(position);
+
+		// Binre Suche nach dem ersten Eintrag mit dem Schlssel
+		size_t low = 0, high = getEntryCount();
+		while (low < high)
+		{
+			auto middle = low + (high - low) / 2;
+			if (readEntry(middle).key < key) low = middle + 1;
+			else high = middle;
+		}
+
+		// Alle Buchzge der Stellung gewichtet auswhlen
+		std::vector<PAIR<Move, UINT32>> candidates;
+		UINT32 total_weight = 0;
+		for (auto index = low; index < getEntryCount(); index++)
+		{
+			auto entry = readEntry(index);
+			if (entry.key != key) break;
+			if (entry.weight == 0) continue;
+
+			auto move = toMove(position, entry.move);
+			if (move.isMoveInvalid()) continue;
+
+			candidates.push_back({ move, entry.weight });
+			total_weight += entry.weight;
+		}
+
+		if (candidates.empty()) return INVALID_MOVE;
+
+		static std::mt19937 random(std::random_device{}());
+		auto choice = std::uniform_int_distribution<UINT32>(0, total_weight - 1)(random);
+
+		for (const auto& [move, weight] : candidates)
+		{
+			if (choice < weight) return move;
+			choice -= weight;
+		}
+
+		return candidates.back().first;
+	}
+
+	size_t OpeningBook::getEntryCount()
+	{
+		return s_file.getSize() / polyglot::ENTRY_SIZE;
+	}
+
+	BookEntry OpeningBook::readEntry(size_t index)
+	{
+		auto data = s_file.getData() + index * polyglot::ENTRY_SIZE;
+
+		// Big Endian lesen
+		auto read = [&data](INT32 bytes) {
+			UINT64 value = 0;
+			for (auto i = 0; i < bytes; i++) value = (value << 8) | *data++;
+			return value;
+		};
+
+		BookEntry entry;
+		entry.key = read(8);
+		entry.move = static_cast<UINT16>(read(2));
+		entry.weight = static_cast<UINT16>(read(2));
+		return entry;
+	}
+
+	Move OpeningBook::toMove(Position& position, UINT16 bookMove)
+	{
+		constexpr CHAR PROMOTIONS[] = { 0, WHITE_KNIGHT, WHITE_BISHOP, WHITE_ROOK, WHITE_QUEEN };
+
+		auto target_x = bookMove & 7;
+		auto target_y = LAST_ROW_INDEX - ((bookMove >> 3) & 7);
+		auto start_x = (bookMove >> 6) & 7;
+		auto start_y = LAST_ROW_INDEX - ((bookMove >> 9) & 7);
+		auto promotion = (bookMove >> 12) & 7;
+		if (promotion >= static_cast<INT32>(sizeof(PROMOTIONS))) return INVALID_MOVE;
+
+		// Rochade: Knig schlgt eigenen Turm => Zielfeld des Knigs
+		auto piece = position[start_y][start_x];
+		if ((piece == WHITE_KING || piece == BLACK_KING) && start_x == 4 && start_y == target_y)
+		{
+			if (target_x == LAST_COLUMN_INDEX) target_x = 6;
+			else if (target_x == FIRST_COLUMN_INDEX) target_x = 2;
+		}
+
+		for (const auto& move : ChessValidation::getValidMoves(position, position.getPlayer()))
+		{
+			if (move.startX != start_x || move.startY != start_y || move.targetX != target_x || move.targetY != target_y) continue;
+			if (std::toupper(move.promotion) != PROMOTIONS[promotion]) continue;
+			return move;
+		}
+
+		return INVALID_MOVE;
+	}
+}
@@ -0,0 +1,61 @@
+#include "OutputWriter.hpp"
+#include <iostream>
+
+namespace owl
+{
+	OutputWriter::OutputWriter()
+	{
+		m_thread = std::thread(&OutputWriter::run, this);
+	}
+
+	OutputWriter::~OutputWriter()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_running = false;
+		}
+		m_condition.notify_all();
+
+		if (m_thread.joinable()) m_thread.join();
+	}
+
+	VOID OutputWriter::writeLine(const std::string& line)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_lines.push(line);
+		}
+		m_condition.notify_all();
+	}
+
+	VOID OutputWriter::flush()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_condition.wait(lock, [this] { return m_lines.empty() && !m_writing; });
+	}
+
+	VOID OutputWriter::run()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+
+		while (true)
+		{
+			m_condition.wait(lock, [this] { return !m_lines.empty() || !m_running; });
+
+			// Restliche Zeilen auch beim Beenden noch ausgeben
+			if (m_lines.empty() && !m_running) break;
+
+			auto line = std::move(m_lines.front());
+			m_lines.pop();
+			m_writing = true;
+
+			// Ohne Sperre schreiben, damit weitere Zeilen eingereiht werden knnen
+			lock.unlock();
+			std::cout << line << std::endl;
+			lock.lock();
+
+			m_writing = false;
+			if (m_lines.empty()) m_condition.notify_all();
+		}
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <queue>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include "defines.hpp"
+
+namespace owl
+{
+	/**
+	 * Ausgabe-Thread fr die Schnittstelle.
+	 * Zeilen werden in eine Warteschlange gelegt und von einem eigenen Thread auf std::cout geschrieben,
+	 * damit der Such-Thread nie auf die Standardausgabe warten muss.
+	 */
+	class OutputWriter
+	{
+	public:
+		explicit OutputWriter();
+		virtual ~OutputWriter();
+		/**
+		 * Eine Zeile zur Ausgabe einreihen. Der Zeilenumbruch wird automatisch angehngt.
+		 *
+		 * \param line Auszugebende Zeile
+		 */
+		VOID writeLine(const std::string& line);
+		/**
+		 * Warte, bis alle eingereihten Zeilen ausgegeben wurden.
+		 */
+		VOID flush();
+	private:
+		/**
+		 * Schleife des Ausgabe-Threads.
+		 */
+		VOID run();
+
+		std::queue<std::string> m_lines;	// Warteschlange der auszugebenden Zeilen
+		std::mutex m_mutex;					// Mutex fr die Warteschlange
+		std::condition_variable m_condition; // Benachrichtigung bei neuen Zeilen bzw. leerer Warteschlange
+		std::thread m_thread;				// Ausgabe-Thread
+		BOOL m_running = true;				// Luft der Ausgabe-Thread?
+		BOOL m_writing = false;				// Wird gerade eine Zeile geschrieben?
+	};
+}
@@ -0,0 +1,43 @@
+#include "PawnHashTable.hpp"
+
+namespace owl
+{
+	const PawnHashEntry* PawnHashTable::probe(UINT64 key)
+	{
+		if (!m_enabled) return nullptr;
+
+		m_probes++;
+
+		const auto& entry = m_data[key & (PAWN_HASH_TABLE_SIZE - 1)];
+		if (!entry.valid || entry.key != key) return nullptr;
+
+		m_hits++;
+		return &entry;
+	}
+	VOID PawnHashTable::store(const PawnHashEntry& entry)
+	{
+		if (!m_enabled) return;
+
+		auto& target = m_data[entry.key & (PAWN_HASH_TABLE_SIZE - 1)];
+		target = entry;
+		target.valid = true;
+	}
+	VOID PawnHashTable::clear()
+	{
+		for (auto& entry : m_data) entry.valid = false;
+		m_probes = 0;
+		m_hits = 0;
+	}
+	VOID PawnHashTable::setEnabled(BOOL enabled)
+	{
+		m_enabled = enabled;
+	}
+	INT64 PawnHashTable::getProbes() const
+	{
+		return m_probes;
+	}
+	INT64 PawnHashTable::getHits() const
+	{
+		return m_hits;
+	}
+}
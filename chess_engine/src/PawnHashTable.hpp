@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+
+#include "defines.hpp"
+#include "Bitboard.hpp"
+
+namespace owl
+{
+	constexpr INT32 PAWN_HASH_TABLE_SIZE = 1 << 14; // Anzahl der Eintrge (Zweierpotenz)
+
+	/**
+	 * Zwischengespeicherte Bauernstruktur einer Stellung.
+	 */
+	struct PawnHashEntry
+	{
+		UINT64 key = 0; // Bauernschlssel der Stellung
+		BOOL valid = false; // Eintrag belegt?
+		std::array<FLOAT, PLAYER_COUNT> score = {}; // Bewertung der Bauernstruktur pro Spieler
+		std::array<BITBOARD, PLAYER_COUNT> passed = {}; // Freibauern pro Spieler
+		std::array<BITBOARD, PLAYER_COUNT> isolated = {}; // Isolierte Bauern pro Spieler
+	};
+
+	/**
+	 * Hash-Tabelle fr die Bauernstruktur. Die Bauernstruktur ndert sich whrend der Suche nur selten,
+	 * daher wird ihre Bewertung ber den Bauernschlssel der Stellung (Position::getPawnKey()) zwischengespeichert.
+	 * Kollisionen werden durch Ersetzen des Eintrags aufgelst.
+	 */
+	class PawnHashTable
+	{
+	public:
+		/**
+		 * Eintrag zu einem Bauernschlssel suchen.
+		 * 
+		 * \param key Bauernschlssel
+		 * \return Gefundener Eintrag oder nullptr
+		 */
+		const PawnHashEntry* probe(UINT64 key);
+		/**
+		 * Eintrag speichern. Ein vorhandener Eintrag am gleichen Index wird berschrieben.
+		 * 
+		 * \param entry Zu speichernder Eintrag
+		 */
+		VOID store(const PawnHashEntry& entry);
+		/**
+		 * Alle Eintrge entfernen.
+		 */
+		VOID clear();
+		/**
+		 * Tabelle ein- oder ausschalten. Ausgeschaltet findet probe() nichts und store() speichert nichts.
+		 * 
+		 * \param enabled Eingeschaltet?
+		 */
+		VOID setEnabled(BOOL enabled);
+		/**
+		 * Anzahl der Abfragen seit dem letzten clear().
+		 */
+		INT64 getProbes() const;
+		/**
+		 * Anzahl der Treffer seit dem letzten clear().
+		 */
+		INT64 getHits() const;
+	private:
+		std::array<PawnHashEntry, PAWN_HASH_TABLE_SIZE> m_data = {}; // Eintrge
+		INT64 m_probes = 0; // Anzahl der Abfragen
+		INT64 m_hits = 0; // Anzahl der Treffer
+		BOOL m_enabled = true; // Eingeschaltet?
+	};
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+
+#include "defines.hpp"
+
+namespace owl
+{
+	/**
+	 * Zusammengefhrte Piece-Square-Tabellen fr alle Figuren beider Spieler.
+	 * Spiegelung fr Schwarz und alle Gewichte werden zur Kompilierzeit eingerechnet,
+	 * sodass ein Wert direkt ber Figurencode und Feld gelesen werden kann.
+	 */
+	namespace pst
+	{
+		constexpr INT32 PIECE_CODES = PLAYER_COUNT * MAX_PIECE_TYPES; // Anzahl der Figurencodes (Spieler und Figurentyp)
+
+		using TABLES = std::array<std::array<FLOAT, MAX_FIELDS_ON_BOARD>, PIECE_CODES>; // Tabellen je Figurencode und Feld
+
+		/**
+		 * Figurencode einer Figur.
+		 *
+		 * \param color Spieler-Index (WHITE_INDEX, BLACK_INDEX)
+		 * \param type Figurentyp-Index (PAWN_INDEX, ...)
+		 * \return Figurencode zwischen 0 und PIECE_CODES - 1
+		 */
+		constexpr INT32 PIECE_CODE(INT32 color, INT32 type)
+		{
+			return color * MAX_PIECE_TYPES + type;
+		}
+
+		/**
+		 * Ungewichtete Tabelle eines Figurentyps aus Sicht von Wei.
+		 *
+		 * \param type Figurentyp-Index
+		 * \param endGame Endspieltabelle (nur fr den Knig verschieden)
+		 * \return Tabelle
+		 */
+		constexpr const std::array<FLOAT, MAX_FIELDS_ON_BOARD>& BASE_TABLE(INT32 type, BOOL endGame)
+		{
+			switch (type)
+			{
+			case PAWN_INDEX: return PIECE_SQUARE_TABLE_PAWN;
+			case KNIGHT_INDEX: return PIECE_SQUARE_TABLE_KNIGHT;
+			case BISHOP_INDEX: return PIECE_SQUARE_TABLE_BISHOP;
+			case ROOK_INDEX: return PIECE_SQUARE_TABLE_ROOK;
+			case QUEEN_INDEX: return PIECE_SQUARE_TABLE_QUEEN;
+			default: return endGame ? PIECE_SQUARE_TABLE_KING_END_GAME : PIECE_SQUARE_TABLE_KING_MID_GAME;
+			}
+		}
+
+		/**
+		 * Gesamtgewicht der Tabelle eines Figurentyps.
+		 * Der Knig wird nur mit seinem eigenen Tabellen-Gewicht gewichtet.
+		 *
+		 * \param type Figurentyp-Index
+		 * \param endGame Endspieltabelle
+		 * \return Gewicht
+		 */
+		constexpr FLOAT WEIGHT(INT32 type, BOOL endGame)
+		{
+			switch (type)
+			{
+			case PAWN_INDEX: return PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_PAWN_WEIGHT;
+			case KNIGHT_INDEX: return PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_KNIGHT_WEIGHT;
+			case BISHOP_INDEX: return PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_BISHOP_WEIGHT;
+			case ROOK_INDEX: return PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_ROOK_WEIGHT;
+			case QUEEN_INDEX: return PIECE_SQUARE_TABLE_WEIGHT * PIECE_SQUARE_TABLE_QUEEN_WEIGHT;
+			default: return endGame ? PIECE_SQUARE_TABLE_KING_END_GAME_WEIGHT : PIECE_SQUARE_TABLE_KING_MID_GAME_WEIGHT;
+			}
+		}
+
+		/**
+		 * Erzeuge die gewichteten Tabellen aller Figurencodes. Fr Schwarz wird an der Mittellinie gespiegelt.
+		 *
+		 * \param endGame Tabellen fr das Endspiel (true) oder Mittelspiel (false)
+		 * \return Tabellen je Figurencode und Feld (Index y * COLUMNS + x)
+		 */
+		constexpr TABLES GENERATE_TABLES(BOOL endGame)
+		{
+			TABLES tables = {};
+			for (auto color = FIRST_PLAYER_INDEX; color < PLAYER_COUNT; color++)
+			{
+				for (auto type = FIRST_PIECE_TYPES_INDEX; type < MAX_PIECE_TYPES; type++)
+				{
+					const auto& table = BASE_TABLE(type, endGame);
+					const auto weight = WEIGHT(type, endGame);
+
+					for (auto y = FIRST_ROW_INDEX; y < ROWS; y++)
+					{
+						auto table_y = color == WHITE_INDEX ? y : LAST_ROW_INDEX - y;
+						for (auto x = FIRST_COLUMN_INDEX; x < COLUMNS; x++)
+						{
+							tables[PIECE_CODE(color, type)][y * COLUMNS + x] = weight * table[table_y * COLUMNS + x];
+						}
+					}
+				}
+			}
+			return tables;
+		}
+
+		constexpr TABLES MID_GAME = GENERATE_TABLES(false); // Gewichtete Tabellen im Mittelspiel
+		constexpr TABLES END_GAME = GENERATE_TABLES(true); // Gewichtete Tabellen im Endspiel
+	}
+}
@@ -1,16 +1,18 @@
 #include "Position.hpp"
 #include <cassert>
 #include "ChessEngine.hpp"
+#include "PieceSquareTable.hpp"
 #include <iostream>
 #include "ChessEvaluation.hpp"
 #include "ChessUtility.hpp"
+#include "Zobrist.hpp"
 
 namespace owl
 {
 	Position::Position()
 		: m_enPassant(false), m_plyCount(0), m_moveNumber(1), m_player(PLAYER_WHITE), m_state(GameState::Active), 
 		m_whiteCastlingShort(true), m_whiteCastlingLong(true), m_blackCastlingShort(true), m_blackCastlingLong(true),
-		m_gamePhase(GamePhase::Opening), m_movedFirstTime(HAS_NOT_MOVED_BIT)
+		m_movedFirstTime(HAS_NOT_MOVED_BIT)
 	{
 		// 2D Array mit 'whitespace' initialisieren
 		for (auto i = FIRST_ROW_INDEX; i < ROWS; i++)
@@ -27,6 +29,11 @@ namespace owl
 		m_kingPosition[SECOND][BLACK_INDEX] = 0;
 
 		m_moveDataStack.push({ Move{}, EMPTY_FIELD, EMPTY_FIELD, false, m_enPassantPosition, {false,0}, m_movedFirstTime });
+
+		m_key = calculateKey();
+		m_pawnKey = calculatePawnKey();
+		calculateBitboards();
+		calculateIncrementalEvaluation();
 	}
 
 	Position::~Position()
@@ -43,7 +50,7 @@ namespace owl
 		m_whiteCastlingShort(whiteCastlingShort), m_whiteCastlingLong(whiteCastlingLong),
 		m_blackCastlingShort(blackCastlingShort), m_blackCastlingLong(blackCastlingLong),
 		m_enPassant(enPassant), m_enPassantPosition(enPassantPosition), 
-		m_plyCount(moveCount), m_moveNumber(moveNumber), m_gamePhase(GamePhase::Opening), m_state(GameState::Active),
+		m_plyCount(moveCount), m_moveNumber(moveNumber), m_state(GameState::Active),
 		m_movedFirstTime(HAS_NOT_MOVED_BIT)
 	{
 		if (m_data[FIRST_ROW_INDEX][FIRST_COLUMN_INDEX] != BLACK_ROOK) m_movedFirstTime |= HAS_BLACK_ROOK_L_MOVED_BIT;
@@ -57,6 +64,11 @@ namespace owl
 
 		calculateKingPositions();
 
+		m_key = calculateKey();
+		m_pawnKey = calculatePawnKey();
+		calculateBitboards();
+		calculateIncrementalEvaluation();
+
 #if DEBUG
 		M_FEN = ChessUtility::positionToFen(*this);
 #endif
@@ -71,11 +83,22 @@ namespace owl
 	VOID Position::applyMove(const Move& move)
 	{	
 		auto move_data = MoveData{move};
-		move_data.lastGamePhase = m_gamePhase;
+		move_data.lastKey = m_key;
+		move_data.lastPawnKey = m_pawnKey;
+		move_data.lastBitboards = m_bitboards;
+		move_data.lastIncrementalEvaluation = m_incrementalEvaluation;
+		m_keyHistory.push_back(m_key);
+
+		// Rochaderechte und En Passant vor dem Zug aus dem Schlssel entfernen
+		m_key ^= getCastlingKey() ^ getEnPassantKey() ^ zobrist::SIDE;
 
 		move_data.piece = m_data[move.startY][move.startX];
 		move_data.capturedPiece = m_data[move.targetY][move.targetX];
 
+		// Figur vom Startfeld und geschlagene Figur entfernen
+		togglePiece(move_data.piece, move.startX, move.startY, false);
+		if (move_data.capturedPiece != EMPTY_FIELD) togglePiece(move_data.capturedPiece, move.targetX, move.targetY, false);
+
 		// Position aktualisieren: Startfeld -> Zielfeld
 		m_data[move.targetY][move.targetX] = move_data.piece;
 		m_data[move.startY][move.startX] = EMPTY_FIELD;
@@ -86,17 +109,22 @@ namespace owl
 			auto rook = m_data[move.startY][FIRST_COLUMN_INDEX];
 			m_data[move.startY][FIRST_COLUMN_INDEX] = EMPTY_FIELD;
 			m_data[move.startY][CASTLING_ROOK_LEFT_X] = rook;
+			togglePiece(rook, FIRST_COLUMN_INDEX, move.startY, false);
+			togglePiece(rook, CASTLING_ROOK_LEFT_X, move.startY, true);
 		}
 		else if (move.castlingShort)
 		{
 			auto rook = m_data[move.startY][LAST_COLUMN_INDEX];
 			m_data[move.startY][LAST_COLUMN_INDEX] = EMPTY_FIELD;
 			m_data[move.startY][CASTLING_ROOK_RIGHT_X] = rook;
+			togglePiece(rook, LAST_COLUMN_INDEX, move.startY, false);
+			togglePiece(rook, CASTLING_ROOK_RIGHT_X, move.startY, true);
 		}
 
 		// En Passant Capturee eingelst? Richtiges Feld lschen
 		if (move.enPassantCapture && (move.targetY == EN_PASSANT_WHITE_Y || move.targetY == EN_PASSANT_BLACK_Y))
 		{
+			togglePiece(m_data[move.startY][move.targetX], move.targetX, move.startY, false);
 			m_data[move.startY][move.targetX] = EMPTY_FIELD;
 		}
 
@@ -176,6 +204,10 @@ namespace owl
 			std::toupper(move_data.move.promotion) : 
 			std::tolower(move_data.move.promotion);
 
+		// (Umgewandelte) Figur auf Zielfeld setzen, neue Rochaderechte und En Passant in den Schlssel aufnehmen
+		togglePiece(m_data[move.targetY][move.targetX], move.targetX, move.targetY, true);
+		m_key ^= getCastlingKey() ^ getEnPassantKey();
+
 		// Spieler fr Halbzug ndern
 		changePlayer();
 
@@ -191,7 +223,11 @@ namespace owl
 		if (m_moveDataStack.size() == 1) return;
 
 		auto& last_move_data = m_moveDataStack.top();
-		m_gamePhase = last_move_data.lastGamePhase;
+		m_key = last_move_data.lastKey;
+		m_pawnKey = last_move_data.lastPawnKey;
+		m_bitboards = last_move_data.lastBitboards;
+		m_incrementalEvaluation = last_move_data.lastIncrementalEvaluation;
+		if (!m_keyHistory.empty()) m_keyHistory.pop_back();
 
 		// Spieler wieder wechseln
 		changePlayer(true);
@@ -410,15 +446,28 @@ namespace owl
 	{
 		m_blackCastlingLong = false;
 	}
-	VOID Position::enterNextGamePhase() const
+	UINT64 Position::getKey() const
 	{
-		if (m_gamePhase == GamePhase::Mid) m_gamePhase = GamePhase::End;
-		else if (m_gamePhase == GamePhase::Opening) m_gamePhase = GamePhase::Mid;
+		return m_key;
 	}
 
-	GamePhase Position::getGamePhase() const
+	UINT64 Position::getPawnKey() const
 	{
-		return m_gamePhase;
+		return m_pawnKey;
+	}
+
+	BOOL Position::isRepetition() const
+	{
+		// Frhestens nach vier Halbzgen kann sich eine Stellung mit gleichem Spieler am Zug wiederholen
+		auto size = static_cast<INT32>(m_keyHistory.size());
+		auto limit = std::min(m_plyCount, size);
+
+		for (auto i = 4; i <= limit; i += 2)
+		{
+			if (m_keyHistory[size - i] == m_key) return true;
+		}
+
+		return false;
 	}
 	VOID Position::print() const
 	{
@@ -441,6 +490,16 @@ namespace owl
 		return { m_kingPosition[FIRST][index], m_kingPosition[SECOND][index] };
 	}
 
+	const IncrementalEvaluation& Position::getIncrementalEvaluation() const
+	{
+		return m_incrementalEvaluation;
+	}
+
+	BITBOARD Position::getBitboard(INT32 color, INT32 type) const
+	{
+		return m_bitboards[color][type];
+	}
+
 	const std::stack<Position::MoveData>& Position::getMoveDataStack() const
 	{
 		return m_moveDataStack;
@@ -503,4 +562,107 @@ namespace owl
 		m_kingPosition[SECOND][index] = y;
 	}
 
+	UINT64 Position::calculateKey() const
+	{
+		UINT64 key = 0;
+
+		for (auto y = FIRST_ROW_INDEX; y < ROWS; y++)
+		{
+			for (auto x = FIRST_COLUMN_INDEX; x < COLUMNS; x++)
+			{
+				if (GET_PIECE_INDEX_BY_TYPE(m_data[y][x]) != EMPTY) key ^= zobrist::PIECE(m_data[y][x], x, y);
+			}
+		}
+
+		if (m_player == PLAYER_BLACK) key ^= zobrist::SIDE;
+
+		return key ^ getCastlingKey() ^ getEnPassantKey();
+	}
+
+	VOID Position::calculateBitboards()
+	{
+		m_bitboards = {};
+
+		for (auto y = FIRST_ROW_INDEX; y < ROWS; y++)
+		{
+			for (auto x = FIRST_COLUMN_INDEX; x < COLUMNS; x++)
+			{
+				auto type = GET_PIECE_INDEX_BY_TYPE(m_data[y][x]);
+				if (type >= 0 && type < MAX_PIECE_TYPES) m_bitboards[GET_PLAYER_INDEX_BY_PIECE(m_data[y][x])][type] |= bitboard::SQUARE(x, y);
+			}
+		}
+	}
+
+	VOID Position::calculateIncrementalEvaluation()
+	{
+		m_incrementalEvaluation = IncrementalEvaluation{};
+
+		for (auto y = FIRST_ROW_INDEX; y < ROWS; y++)
+		{
+			for (auto x = FIRST_COLUMN_INDEX; x < COLUMNS; x++)
+			{
+				if (GET_PIECE_INDEX_BY_TYPE(m_data[y][x]) != EMPTY) updateIncrementalEvaluation(m_data[y][x], x, y, true);
+			}
+		}
+	}
+
+	VOID Position::togglePiece(CHAR piece, INT32 x, INT32 y, BOOL add)
+	{
+		auto type = GET_PIECE_INDEX_BY_TYPE(piece);
+		if (type < 0 || type >= MAX_PIECE_TYPES) return;
+
+		m_key ^= zobrist::PIECE(piece, x, y);
+		if (type == PAWN_INDEX) m_pawnKey ^= zobrist::PIECE(piece, x, y);
+		m_bitboards[GET_PLAYER_INDEX_BY_PIECE(piece)][type] ^= bitboard::SQUARE(x, y);
+		updateIncrementalEvaluation(piece, x, y, add);
+	}
+
+	VOID Position::updateIncrementalEvaluation(CHAR piece, INT32 x, INT32 y, BOOL add)
+	{
+		auto type = GET_PIECE_INDEX_BY_TYPE(piece);
+		if (type < 0 || type >= MAX_PIECE_TYPES) return;
+
+		auto color = GET_PLAYER_INDEX_BY_PIECE(piece);
+		auto sign = add ? 1 : -1;
+
+		auto& evaluation = m_incrementalEvaluation;
+		evaluation.pieceCount[color][type] += sign;
+		evaluation.material[color] += sign * MATERIAL_VALUES[type];
+		if (type != PAWN_INDEX) evaluation.nonPawnMaterial[color] += sign * MATERIAL_VALUES[type];
+
+		auto code = pst::PIECE_CODE(color, type);
+		evaluation.squareTableMid[color] += sign * pst::MID_GAME[code][y * COLUMNS + x];
+		evaluation.squareTableEnd[color] += sign * pst::END_GAME[code][y * COLUMNS + x];
+	}
+
+	UINT64 Position::calculatePawnKey() const
+	{
+		UINT64 key = 0;
+
+		for (auto y = FIRST_ROW_INDEX; y < ROWS; y++)
+		{
+			for (auto x = FIRST_COLUMN_INDEX; x < COLUMNS; x++)
+			{
+				if (GET_PIECE_INDEX_BY_TYPE(m_data[y][x]) == PAWN_INDEX) key ^= zobrist::PIECE(m_data[y][x], x, y);
+			}
+		}
+
+		return key;
+	}
+
+	UINT64 Position::getCastlingKey() const
+	{
+		UINT64 key = 0;
+		if (m_whiteCastlingShort) key ^= zobrist::CASTLING(zobrist::WHITE_CASTLING_SHORT);
+		if (m_whiteCastlingLong) key ^= zobrist::CASTLING(zobrist::WHITE_CASTLING_LONG);
+		if (m_blackCastlingShort) key ^= zobrist::CASTLING(zobrist::BLACK_CASTLING_SHORT);
+		if (m_blackCastlingLong) key ^= zobrist::CASTLING(zobrist::BLACK_CASTLING_LONG);
+		return key;
+	}
+
+	UINT64 Position::getEnPassantKey() const
+	{
+		return m_enPassant ? zobrist::EN_PASSANT(m_enPassantPosition.first) : 0;
+	}
+
 }
@@ -3,9 +3,11 @@
 #include <string>
 #include <array>
 #include <stack>
+#include <vector>
 
 #include "defines.hpp"
 #include "Move.hpp"
+#include "Bitboard.hpp"
 
 namespace owl
 {
@@ -21,13 +23,16 @@ namespace owl
 	};
 
 	/**
-	 * Mgliche Spielphasen einer Stellung.
+	 * Bewertungsanteile, die von der Position bei jedem Zug inkrementell aktualisiert werden,
+	 * damit die Evaluierung nicht alle Felder nach Material und Piece-Square-Tabellen durchsuchen muss.
 	 */
-	enum class GamePhase
+	struct IncrementalEvaluation
 	{
-		Opening, // Erffnung
-		Mid, // Mittelspiel
-		End // Endspiel
+		std::array<FLOAT, PLAYER_COUNT> material{}; // Materialwert pro Spieler
+		std::array<FLOAT, PLAYER_COUNT> nonPawnMaterial{}; // Materialwert ohne Bauern pro Spieler (zur Bestimmung der Spielphase)
+		std::array<std::array<INT32, MAX_PIECE_TYPES>, PLAYER_COUNT> pieceCount{}; // Figurenanzahl pro Spieler und Figurentyp
+		std::array<FLOAT, PLAYER_COUNT> squareTableMid{}; // Summe der Piece-Square-Tabellen im Mittelspiel
+		std::array<FLOAT, PLAYER_COUNT> squareTableEnd{}; // Summe der Piece-Square-Tabellen im Endspiel
 	};
 
 	/**
@@ -176,15 +181,40 @@ namespace owl
 		 */
 		VOID resetBlackCastlingLong();
 		/**
-		 * Betrete die nchste Spielphase.
+		 * Zobrist-Schlssel der Stellung (Figuren, Spieler am Zug, Rochaderechte und En Passant).
+		 * Wird mit jedem Zug inkrementell aktualisiert.
+		 * 
+		 * \return Schlssel der Stellung
+		 */
+		UINT64 getKey() const;
+		/**
+		 * Zobrist-Schlssel der Bauernstellung (nur Bauern beider Spieler).
+		 * Wird mit jedem Zug inkrementell aktualisiert und fr die Bauern-Hash-Tabelle verwendet.
+		 * 
+		 * \return Bauernschlssel der Stellung
+		 */
+		UINT64 getPawnKey() const;
+		/**
+		 * Ist die Stellung seit dem letzten irreversiblen Zug (Bauernzug oder Schlagzug) bereits aufgetreten?
+		 * Geprft werden nur Stellungen mit dem gleichen Spieler am Zug.
+		 * 
+		 * \return Stellungswiederholung?
+		 */
+		BOOL isRepetition() const;
+		/**
+		 * Inkrementell aktualisierte Bewertungsanteile (Material, Figurenanzahl, Piece-Square-Tabellen).
+		 * 
+		 * \return Bewertungsanteile der Stellung
 		 */
-		VOID enterNextGamePhase() const;
+		const IncrementalEvaluation& getIncrementalEvaluation() const;
 		/**
-		 * Aktuelle Spielphase abrufen.
+		 * Bitboard der Figuren eines Spielers und Figurentyps. Wird mit jedem Zug inkrementell aktualisiert.
 		 * 
-		 * \return Aktuelle Spielphase
+		 * \param color Spielerfarbe (WHITE_INDEX, BLACK_INDEX)
+		 * \param type Figurentyp (PAWN_INDEX, ..., KING_INDEX)
+		 * \return Bitboard der Figuren
 		 */
-		GamePhase getGamePhase() const;
+		BITBOARD getBitboard(INT32 color, INT32 type) const;
 
 		/**
 		 * Print-Funktion zur Ausgabe der Stellung.
@@ -239,7 +269,10 @@ namespace owl
 			PAIR<INT32, INT32> enPassantPos; // Position des vorherigen En Passants
 			PAIR<BOOL, INT32> plyCountReset; // Halbzge-Reset? und vorheriger Halbzug-Wert
 			UCHAR movedFirstTimeFlag; // Bitflags: Haben sich Turm oder Knig das erste mal bewegt
-			GamePhase lastGamePhase; // Zum setzten der alten Phase, die durch die Evaluierung verndert wurde
+			UINT64 lastKey; // Zobrist-Schlssel vor dem Zug
+			UINT64 lastPawnKey; // Bauernschlssel vor dem Zug
+			std::array<std::array<BITBOARD, MAX_PIECE_TYPES>, PLAYER_COUNT> lastBitboards; // Bitboards vor dem Zug
+			IncrementalEvaluation lastIncrementalEvaluation; // Bewertungsanteile vor dem Zug
 		};
 		/**
 		 * Gebe den MoveData-Stapel zurck.
@@ -255,7 +288,12 @@ namespace owl
 		INT32 m_player; // Aktueller Spieler
 		
 		mutable GameState m_state; // Korrespondierender Spielzustand zur Position (Aktiv, Sieg fr Wei/Schwarz oder Remis)
-		mutable GamePhase m_gamePhase; // Spielphase
+
+		UINT64 m_key = 0; // Zobrist-Schlssel der Stellung
+		UINT64 m_pawnKey = 0; // Zobrist-Schlssel der Bauernstellung
+		std::vector<UINT64> m_keyHistory; // Zobrist-Schlssel aller vorherigen Stellungen (fr die Stellungswiederholung)
+		IncrementalEvaluation m_incrementalEvaluation; // Inkrementell aktualisierte Bewertungsanteile
+		std::array<std::array<BITBOARD, MAX_PIECE_TYPES>, PLAYER_COUNT> m_bitboards{}; // Bitboards pro Spieler und Figurentyp
 
 		BOOL m_enPassant; // En Passant mglich?
 		BOOL m_whiteCastlingShort; // Kann Wei noch kurz rochieren?
@@ -290,6 +328,53 @@ namespace owl
 		 * \param y Reihe
 		 */
 		VOID setKingPosition(INT32 index, INT32 x, INT32 y);
+		/**
+		 * Berechne den Zobrist-Schlssel der Stellung vollstndig neu.
+		 * 
+		 * \return Schlssel der Stellung
+		 */
+		UINT64 calculateKey() const;
+		/**
+		 * Berechne den Bauernschlssel der Stellung vollstndig neu.
+		 * 
+		 * \return Bauernschlssel der Stellung
+		 */
+		UINT64 calculatePawnKey() const;
+		/**
+		 * Schlsselanteil der aktuellen Rochaderechte.
+		 */
+		UINT64 getCastlingKey() const;
+		/**
+		 * Schlsselanteil des aktuellen En Passant.
+		 */
+		UINT64 getEnPassantKey() const;
+		/**
+		 * Berechne die Bitboards aller Figuren vollstndig neu.
+		 */
+		VOID calculateBitboards();
+		/**
+		 * Berechne die inkrementellen Bewertungsanteile vollstndig neu.
+		 */
+		VOID calculateIncrementalEvaluation();
+		/**
+		 * Figur auf einem Feld hinzufgen bzw. entfernen und dabei Zobrist-Schlssel, Bauernschlssel, Bitboards
+		 * und inkrementelle Bewertungsanteile aktualisieren. Das Spielfeld selbst wird nicht verndert.
+		 * 
+		 * \param piece Figur (kein leeres Feld)
+		 * \param x Spalte
+		 * \param y Reihe
+		 * \param add Hinzufgen (true) oder entfernen (false)
+		 */
+		VOID togglePiece(CHAR piece, INT32 x, INT32 y, BOOL add);
+		/**
+		 * Material, Figurenanzahl und Piece-Square-Tabellen fr eine hinzugefgte bzw. entfernte Figur aktualisieren.
+		 * 
+		 * \param piece Figur
+		 * \param x Spalte
+		 * \param y Reihe
+		 * \param add Hinzufgen (true) oder entfernen (false)
+		 */
+		VOID updateIncrementalEvaluation(CHAR piece, INT32 x, INT32 y, BOOL add);
 #if DEBUG
 	public:
 		std::string M_FEN; // FEN-String der Position (Fr Debug-Zwecke)
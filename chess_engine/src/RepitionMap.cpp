@@ -6,30 +6,33 @@ namespace owl
 {
 	VOID RepitionMap::addPosition(const Position& position)
 	{
-		auto search = m_data.find(position);
+		m_data[m_next] = position.getKey();
+		m_next = (m_next + 1) % REPITION_MAP_SIZE;
+		if (m_size < REPITION_MAP_SIZE) m_size++;
 
-		if (search != m_data.end())
+		// Stellungswiederholung 3x?
+		if (count(position.getKey()) >= 3)
 		{
-			m_data[position]++;
-			// Stellungswiederholung 3x?
-			if (m_data[position] >= 3)
-			{
-				position.setGameState(GameState::Remis);
-			}
-		}
-		else
-		{
-			m_data[position] = 1;
+			position.setGameState(GameState::Remis);
 		}
 	}
 	BOOL RepitionMap::isPositionAlreadyLocked(const Position& position) const
 	{
-		auto search = m_data.find(position);
-		if (search != m_data.end())
+		return count(position.getKey()) >= 2;
+	}
+	VOID RepitionMap::clear()
+	{
+		m_next = 0;
+		m_size = 0;
+	}
+	INT32 RepitionMap::count(UINT64 key) const
+	{
+		INT32 result = 0;
+		for (auto i = 0; i < m_size; i++)
 		{
-			if (m_data[position] >= 2) return true;
+			if (m_data[i] == key) result++;
 		}
-		
-		return false;
+
+		return result;
 	}
-}
\ No newline at end of file
+}
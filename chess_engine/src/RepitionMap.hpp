@@ -1,16 +1,18 @@
 #pragma once
 
-#include <unordered_map>
-#include <string>
+#include <array>
 
 #include "Position.hpp"
 
 namespace owl
 {
+	constexpr INT32 REPITION_MAP_SIZE = 128; // Anzahl der gespeicherten Stellungen (mindestens so gro wie das 50-Zge-Fenster)
+
 	/**
-	 *  Datenstruktur zur berprfung der Stellungswiederholung. Diese verwendet ein Dictionary-Datenstruktur.
-	 * Diese besteht aus Positions-Schlssel (UINT64-Hash aus allen Zellen des Spielfelds)
-	 * Jeder Schlssel verweist auf die Anzahl der Wiederholungen der korrespondierenden Schachstellung.
+	 *  Datenstruktur zur berprfung der Stellungswiederholung auf Ebene der Partie. Diese verwendet einen Ringpuffer fester Gre.
+	 * Dieser besteht aus den Zobrist-Schlsseln der zuletzt hinzugefgten Stellungen.
+	 * ltere Stellungen werden berschrieben, da sie nach der 50-Zge-Regel ohnehin nicht mehr wiederholt werden knnen.
+	 * Wiederholungen innerhalb des Suchbaums erkennt Position::isRepetition().
 	 */
 	class RepitionMap
 	{
@@ -28,44 +30,21 @@ namespace owl
 		 * \return Ist die Position blockiert?
 		 */
 		BOOL isPositionAlreadyLocked(const Position& position) const;
-
 		/**
-		 * Hash-Funktions-Struct fr Positionen
+		 * Alle gespeicherten Stellungen entfernen.
 		 */
-		struct HashFunction
-		{
-			/**
-			 * Hash-Funktion fr Positionen
-			 * 
-			 * \param position Die Stellung der gehasht werden soll
-			 * \return Der Hashwert
-			 */
-			UINT64 operator()(const Position& position) const
-			{
-				UINT64 rows[ROWS];
-
-				for (auto y = FIRST_ROW_INDEX; y < ROWS; y++)
-				{
-					std::string pos_str = "";
-					for (auto x = FIRST_COLUMN_INDEX; x < COLUMNS; x++)
-					{
-						pos_str += position[y][x];
-					}
-
-					rows[y] = std::hash<std::string>()(pos_str);
-				}
-				
-				UINT64 result = 0;
-				for (auto row : rows)
-				{
-					result ^= row;
-				}
-
-				return result;
-			}
-		};
+		VOID clear();
 	private:
-		mutable std::unordered_map<Position, INT32, HashFunction> m_data; // Hash-Map fr die Stellungswiederholungsberprfung
+		/**
+		 * Anzahl der Vorkommen eines Schlssels im Ringpuffer.
+		 * 
+		 * \param key Zobrist-Schlssel
+		 * \return Anzahl
+		 */
+		INT32 count(UINT64 key) const;
 
+		std::array<UINT64, REPITION_MAP_SIZE> m_data = {}; // Ringpuffer der Stellungsschlssel
+		INT32 m_next = 0; // Nchster Schreibindex
+		INT32 m_size = 0; // Anzahl der gltigen Eintrge
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+
+#include "defines.hpp"
+#include "Move.hpp"
+
+namespace owl
+{
+	/**
+	 * Ein Zug an der Wurzel der Suche samt seiner Suchergebnisse.
+	 */
+	struct RootMove
+	{
+		Move move;						// Wurzelzug
+		EVALUATION_VALUE score = -INF;	// Bewertung aus der letzten Durchsuchung des Zugs (exakt nur fr Hauptvarianten)
+		INT64 nodes = 0;				// Anzahl der durchsuchten Knoten im Teilbaum des Zugs (ber alle Iterationen)
+		MOVE_LIST pv;					// Hauptvariante beginnend mit dem Wurzelzug
+
+		// Konstruktor mit Zuweisung des Wurzelzugs
+		explicit RootMove(const Move& rootMove)
+			: move(rootMove)
+		{}
+	};
+
+	using ROOT_MOVE_LIST = std::vector<RootMove>; // Alias fr die Liste der Wurzelzge
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <functional>
+
+#include "defines.hpp"
+#include "Move.hpp"
+
+namespace owl
+{
+	/**
+	 * Informationen zum aktuellen Stand der Suche, die whrend der iterativen Vertiefung
+	 * an die Schnittstelle (z.B. UCI "info") weitergegeben werden.
+	 */
+	struct SearchInfo
+	{
+		/**
+		 * Art der Information.
+		 */
+		enum class Type
+		{
+			Iteration,	// Eine Iteration der iterativen Vertiefung wurde abgeschlossen
+			CurrMove	// Ein neuer Zug wird an der Wurzel untersucht
+		};
+
+		Type type = Type::Iteration; // Art der Information
+		INT32 depth = 0;			// Abgeschlossene bzw. aktuelle Suchtiefe
+		INT32 selDepth = 0;			// Maximal erreichte Suchtiefe (Halbzge ab der Wurzel)
+		INT32 multiPv = 1;			// Nummer der Hauptvariante bei MultiPV, beginnend bei 1
+		EVALUATION_VALUE score;		// Bewertung aus Sicht der Engine
+		INT64 nodes = 0;			// Anzahl der bisher durchsuchten Knoten
+		INT64 nps = 0;				// Knoten pro Sekunde
+		INT64 time = 0;				// Bisherige Suchzeit in ms
+		MOVE_LIST pv;				// Hauptvariante (Principal Variation)
+		Move currMove;				// Aktuell untersuchter Wurzelzug (Type::CurrMove)
+		INT32 currMoveNumber = 0;	// Nummer des aktuell untersuchten Wurzelzugs, beginnend bei 1 (Type::CurrMove)
+	};
+
+	/**
+	 * Grenzen einer Suche (z.B. aus dem UCI-Befehl "go"). Ein Wert von 0 bedeutet keine Einschrnkung.
+	 */
+	struct SearchLimits
+	{
+		BOOL infinite = false;	// Analysemodus: Bis MAX_SEARCH_DEPTH vertiefen und erst nach stop() zurckkehren
+		INT64 moveTime = 0;		// Maximale Suchzeit in ms
+		INT64 nodes = 0;		// Maximale Anzahl der zu durchsuchenden Knoten
+		MOVE_LIST searchMoves;	// Suche an der Wurzel auf diese Zge einschrnken (leer: alle legalen Zge)
+	};
+
+	using SEARCH_INFO_CALLBACK = std::function<VOID(const SearchInfo&)>; // Rckruffunktion fr Suchinformationen
+}
@@ -0,0 +1,51 @@
+#include "SearchStatistics.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+namespace owl
+{
+	VOID SearchStatistics::clear()
+	{
+		*this = SearchStatistics();
+	}
+
+	FLOAT SearchStatistics::getFirstMoveCutoffRate() const
+	{
+		return cutoffs > 0 ? 100.0f * firstMoveCutoffs / cutoffs : 0.0f;
+	}
+
+	FLOAT SearchStatistics::getEffectiveBranchingFactor() const
+	{
+		if (iterationNodes.size() < 3) return 0.0f;
+
+		auto last = iterationNodes.end();
+		auto previous = *(last - 2) - *(last - 3);
+		return previous > 0 ? static_cast<FLOAT>(*(last - 1) - *(last - 2)) / previous : 0.0f;
+	}
+
+	FLOAT SearchStatistics::getHitRate(INT64 probes, INT64 hits)
+	{
+		return probes > 0 ? 100.0f * hits / probes : 0.0f;
+	}
+
+	std::string SearchStatistics::toString() const
+	{
+		std::ostringstream out;
+		out << std::fixed << std::setprecision(2);
+
+		// Knoten je Halbzug bis zum letzten belegten Halbzug
+		out << "nodesbyply";
+		auto last_ply = static_cast<INT32>(nodesByPly.size()) - 1;
+		while (last_ply > 0 && nodesByPly[last_ply] == 0) last_ply--;
+		for (auto ply = 0; ply <= last_ply; ply++) out << " " << nodesByPly[ply];
+
+		out << " cutoffs " << cutoffs
+			<< " firstmovecutoffs " << getFirstMoveCutoffRate() << "%"
+			<< " evalcache " << evaluationCacheHits << "/" << evaluationCacheProbes << " " << getHitRate(evaluationCacheProbes, evaluationCacheHits) << "%"
+			<< " pawnhash " << pawnHashHits << "/" << pawnHashProbes << " " << getHitRate(pawnHashProbes, pawnHashHits) << "%"
+			<< " ebf " << getEffectiveBranchingFactor();
+
+		return out.str();
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "defines.hpp"
+
+namespace owl
+{
+	/**
+	 * Statistik einer Suche zur Abstimmung der Such-Bausteine (UCI-Befehl "stats" bzw. Engine-Option "SearchStatistics").
+	 * Die Zhler werden nur vom Such-Thread geschrieben und sind daher einfache Ganzzahlen ohne Synchronisation.
+	 */
+	struct SearchStatistics
+	{
+		std::array<INT64, MAX_SEARCH_DEPTH + 1> nodesByPly = {}; // Durchsuchte Knoten je Halbzug ab der Wurzel
+		INT64 cutoffs = 0;					// Beta-Schnitte (Abschneidungen)
+		INT64 firstMoveCutoffs = 0;			// Beta-Schnitte durch den ersten untersuchten Zug (Gte der Zugsortierung)
+		INT64 evaluationCacheProbes = 0;	// Abfragen des Bewertungs-Zwischenspeichers
+		INT64 evaluationCacheHits = 0;		// Treffer des Bewertungs-Zwischenspeichers
+		INT64 pawnHashProbes = 0;			// Abfragen der Bauern-Hash-Tabelle
+		INT64 pawnHashHits = 0;				// Treffer der Bauern-Hash-Tabelle
+		std::vector<INT64> iterationNodes;	// Knoten (kumuliert) nach jeder abgeschlossenen Iteration
+
+		/**
+		 * Alle Zhler zurcksetzen.
+		 */
+		VOID clear();
+		/**
+		 * Einen Beta-Schnitt zhlen.
+		 *
+		 * \param firstMove Schnitt durch den ersten untersuchten Zug?
+		 */
+		VOID addCutoff(BOOL firstMove)
+		{
+			cutoffs++;
+			if (firstMove) firstMoveCutoffs++;
+		}
+		/**
+		 * Anteil der Beta-Schnitte durch den ersten Zug in Prozent.
+		 */
+		FLOAT getFirstMoveCutoffRate() const;
+		/**
+		 * Effektiver Verzweigungsfaktor: Knoten der letzten durch Knoten der vorletzten Iteration, jeweils als Zuwachs
+		 * der kumulierten Knoten (0, wenn weniger als drei Iterationen abgeschlossen sind).
+		 */
+		FLOAT getEffectiveBranchingFactor() const;
+		/**
+		 * Trefferquote in Prozent.
+		 *
+		 * \param probes Abfragen
+		 * \param hits Treffer
+		 * \return Trefferquote (0 ohne Abfragen)
+		 */
+		static FLOAT getHitRate(INT64 probes, INT64 hits);
+		/**
+		 * Statistik als Text, z.B. fr "info string".
+		 *
+		 * \return Zeile mit allen Werten
+		 */
+		std::string toString() const;
+	};
+}
@@ -2,8 +2,12 @@
 #include "ChessUtility.hpp"
 #include "ChessEvaluation.hpp"
 #include "ChessValidation.hpp"
+#include "Bitbase.hpp"
+#include "Benchmark.hpp"
 
+#include <algorithm>
 #include <regex>
+#include <sstream>
 
 namespace owl
 {
@@ -14,6 +18,7 @@ namespace owl
     UniversalChessInterface::UniversalChessInterface()
         : IChessInterface()
     {
+        m_pEngine->setSearchInfoCallback([this](const SearchInfo& info) { handleSearchInfo(info); });
     }
 
     /**
@@ -66,9 +71,18 @@ namespace owl
         case Command::GETVALIDMOVES:
             handleGetValidMovesCommand(command);
             break;
+        case Command::BITBASES:
+            handleBitbasesCommand(command);
+            break;
+        case Command::BENCH:
+            handleBenchCommand(command);
+            break;
+        case Command::STATS:
+            handleStatsCommand(command);
+            break;
         case Command::INVALID:
         default:
-            std::cout << "invalid command!" << std::endl;
+            m_writer.writeLine("invalid command!");
             break;
         }
     }
@@ -80,8 +94,8 @@ namespace owl
      */
     VOID UniversalChessInterface::handleUciCommand(Command& cmd)
     {
-        std::cout << "id name " << ENGINE_ID << std::endl;
-        std::cout << "id author " << ENGINE_AUTHOR << std::endl;
+        m_writer.writeLine(std::string("id name ") + ENGINE_ID);
+        m_writer.writeLine(std::string("id author ") + ENGINE_AUTHOR);
 
         // send the settings which the engine supports via the options command
         const auto& options = m_pEngine->getOptions().getEngineOptions();
@@ -90,10 +104,10 @@ namespace owl
             if (!it.second.isSupported)
                 continue;
 
-            std::cout << "option name " << it.first << " type " << it.second.type << " default " << it.second.default_value << std::endl;
+            m_writer.writeLine("option name " + it.first + " type " + it.second.type + " default " + it.second.default_value);
         }
 
-        std::cout << "uciok" << std::endl;
+        m_writer.writeLine("uciok");
     }
 
     /**
@@ -126,7 +140,7 @@ namespace owl
     {
         if (m_pEngine->isReady())
         {
-            std::cout << "readyok" << std::endl;
+            m_writer.writeLine("readyok");
         }
         else {
             m_mutex.lock();
@@ -201,7 +215,7 @@ namespace owl
 
         this->handleStopCommand(cmd);
 
-        std::cout << "quit ok" << std::endl;
+        m_writer.writeLine("quit ok");
     }
 
     /**
@@ -218,12 +232,15 @@ namespace owl
             handleGoSubcommand(arg, *subcommandData);
         }
 
-        if (m_pEngine->isReady()) {
-            if (m_minmaxThread.joinable()) {
-                m_minmaxThread.join();
-            }
+        // a still running search is stopped first (the GUI should have sent "stop")
+        if (m_minmaxThread.joinable()) {
+            if (!m_pEngine->isReady()) m_pEngine->stop();
+            m_minmaxThread.join();
         }
 
+        // reset the stop signal before the thread starts, so an immediate "stop" can't get lost
+        m_pEngine->prepareSearch();
+
         //go(subcommandData);
         this->m_minmaxThread = std::thread(&UniversalChessInterface::go, this, subcommandData);
     }
@@ -253,15 +270,12 @@ namespace owl
         // check if it is the searchmoves command since it is the only command left that doesnt have an integer value
         if (arg.find("searchmoves") != std::string::npos)
         {
-            if (std::regex_search(arg, match, std::regex("([a-hA-H0-8x\\+]{4,6})")))
+            // collect every move after the keyword
+            const std::string moves_str = arg.substr(arg.find("searchmoves") + std::string("searchmoves").size());
+            const std::regex move_regex("[a-hA-H0-8x\\+\\-qrnQRN]{4,7}");
+            for (auto it = std::sregex_iterator(moves_str.begin(), moves_str.end(), move_regex); it != std::sregex_iterator(); it++)
             {
-                for (size_t i = 1; i < match.size(); i++)
-                {
-                    if (match.str(i).empty())
-                        continue;
-
-                    data.searchmoves.push_back(match.str(i));
-                }
+                data.searchmoves.push_back(it->str());
             }
             return;
         }
@@ -356,7 +370,7 @@ namespace owl
      */
     VOID UniversalChessInterface::handlePonderhitCommand(Command& cmd)
     {
-        std::cout << "command not implemented yet" << std::endl;
+        m_writer.writeLine("command not implemented yet");
     }
 
     /**
@@ -366,7 +380,7 @@ namespace owl
      */
     VOID UniversalChessInterface::handleRegisterCommand(Command& cmd)
     {
-        std::cout << "command not implemented yet" << std::endl;
+        m_writer.writeLine("command not implemented yet");
     }
 
     /**
@@ -376,45 +390,159 @@ namespace owl
      */
     VOID UniversalChessInterface::handleUciNewGameCommand(Command& cmd)
     {
-        m_pEngine->getPosition() = ChessUtility::fenToPosition(STARTPOS_FEN);
+        m_pEngine->newGame();
     }
 
     VOID UniversalChessInterface::handleEvaluateCommand(Command& cmd)
     {
-        std::cout << ChessEvaluation::evaluate(m_pEngine->getPosition(), EVAL_FT_STANDARD) << std::endl;
+        std::ostringstream out;
+        const auto& position = m_pEngine->getPosition();
+        out << ChessEvaluation::trace(position, position.getPlayer(), EVAL_FT_STANDARD);
+        m_writer.writeLine(out.str());
+    }
+
+    VOID UniversalChessInterface::handleBitbasesCommand(Command& cmd)
+    {
+        // a running search reads the bitbases and the evaluation cache at every leaf
+        if (m_minmaxThread.joinable()) {
+            if (!m_pEngine->isReady()) m_pEngine->stop();
+            m_minmaxThread.join();
+        }
+
+        // regenerate the bitbases and drop evaluations that were cached with the old ones
+        Bitbase::init(BITBASE_FILE, true);
+        m_pEngine->clearEvaluationCache();
+
+        m_writer.writeLine("info string bitbases KPK KRK KQK generated");
+    }
+
+    VOID UniversalChessInterface::handleBenchCommand(Command& cmd)
+    {
+        // optional argument: depth, an invalid value keeps the default
+        const auto& args = cmd.getArgs();
+        INT32 depth = BENCH_DEFAULT_DEPTH;
+        if (args.size() > 0)
+        {
+            try
+            {
+                depth = std::clamp(std::stoi(args[0]), 1, MAX_SEARCH_DEPTH);
+            }
+            catch (const std::exception&)
+            {
+            }
+        }
+
+        // a running search would distort the measured time
+        if (m_minmaxThread.joinable()) {
+            if (!m_pEngine->isReady()) m_pEngine->stop();
+            m_minmaxThread.join();
+        }
+
+        // the search is single-threaded and the evaluation caches have a fixed size, so "threads" and "hash" have no effect
+        if (args.size() > 1) m_writer.writeLine("info string bench ignores threads and hash");
+        m_writer.writeLine("info string bench depth " + std::to_string(depth));
+
+        auto result = Benchmark::run(depth, [this](INT32 index, const std::string& fen, INT64 nodes, INT64 time) {
+            m_writer.writeLine("info string position " + std::to_string(index) + " nodes " + std::to_string(nodes)
+                + " time " + std::to_string(time) + " fen " + fen);
+        });
+
+        m_writer.writeLine("Total time (ms) : " + std::to_string(result.time));
+        m_writer.writeLine("Nodes searched  : " + std::to_string(result.nodes));
+        m_writer.writeLine("Nodes/second    : " + std::to_string(result.getNodesPerSecond()));
+    }
+
+    VOID UniversalChessInterface::handleStatsCommand(Command& cmd)
+    {
+        m_writer.writeLine("info string stats " + m_pEngine->getStatistics().toString());
     }
 
     VOID UniversalChessInterface::handleGetValidMovesCommand(Command& cmd)
     {
         MOVE_LIST moves = ChessValidation::getValidMoves(m_pEngine->getPosition(), m_pEngine->getPosition().getPlayer());
+        std::string out;
         for (auto& move : moves)
         {
-            std::cout << ChessUtility::moveToString(move) << ", ";
+            out += ChessUtility::moveToString(move) + ", ";
         }
 
-        if (!moves.empty()) std::cout << ChessUtility::moveToString(moves.back()) << std::endl;
+        if (!moves.empty()) m_writer.writeLine(out + ChessUtility::moveToString(moves.back()));
     }
 
     VOID UniversalChessInterface::go(std::shared_ptr<GoSubcommandData> p_data)
     {
-        INT32 depth = p_data->depth == 0 ? MAX_DEPTH : p_data->depth;
+        // without a depth limit, time and node limits decide when the search ends
+        INT32 depth = p_data->depth > 0 ? p_data->depth 
+            : (p_data->movetime > 0 || p_data->nodes > 0) ? MAX_SEARCH_DEPTH : MAX_DEPTH;
 
         Position pos = m_pEngine->getPosition();
 
-        auto result = m_pEngine->searchMove(m_pEngine->getPosition().getPlayer(), depth, FT_STANDARD);
+        SearchLimits limits;
+        limits.infinite = p_data->infinite;
+        limits.moveTime = p_data->movetime;
+        limits.nodes = p_data->nodes;
+
+        // convert the "searchmoves" once, relative to the current position
+        for (const auto& move_str : p_data->searchmoves)
+        {
+            limits.searchMoves.push_back(ChessUtility::stringToMove(move_str, &pos));
+        }
+
+        auto result = m_pEngine->searchMove(m_pEngine->getPosition().getPlayer(), depth, FT_STANDARD, limits);
 
         auto best = result.first;
-        auto value = result.second;
 
-        std::cout << "info depth 0 " << ChessEvaluation::evaluate(pos, m_pEngine->getPlayer(), EVAL_FT_STANDARD, false) << "\n";
-        std::cout << "info score " << value << " cp " << ChessUtility::convertToCentipawns(value) << std::endl;
-        std::cout << "bestmove " << ChessUtility::moveToString(best) << std::endl;
+        if (m_pEngine->inDebugMode())
+        {
+            std::ostringstream out;
+            out << "info string static eval " << ChessEvaluation::trace(pos, m_pEngine->getPlayer(), EVAL_FT_STANDARD);
+            m_writer.writeLine(out.str());
+        }
+        if (m_pEngine->getOptions().getValue("SearchStatistics") == "true")
+        {
+            m_writer.writeLine("info string stats " + m_pEngine->getStatistics().toString());
+        }
+        m_writer.writeLine("bestmove " + ChessUtility::moveToString(best));
 
         if (m_readyCheckQueued) {
-            std::cout << "readyok" << std::endl;
+            m_writer.writeLine("readyok");
             m_mutex.lock();
             m_readyCheckQueued = false;
             m_mutex.unlock();
         }
     }
-}
+
+    VOID UniversalChessInterface::handleSearchInfo(const SearchInfo& info)
+    {
+        std::ostringstream out;
+
+        if (info.type == SearchInfo::Type::CurrMove)
+        {
+            out << "info depth " << info.depth
+                << " currmove " << ChessUtility::moveToString(info.currMove)
+                << " currmovenumber " << info.currMoveNumber;
+        }
+        else
+        {
+            out << "info depth " << info.depth
+                << " seldepth " << info.selDepth
+                << " multipv " << info.multiPv
+                << " score ";
+
+            if (IS_MATE_SCORE(info.score)) out << "mate " << MATE_IN_MOVES(info.score);
+            else out << "cp " << info.score;
+
+            out << " nodes " << info.nodes
+                << " nps " << info.nps
+                << " time " << info.time;
+
+            if (!info.pv.empty())
+            {
+                out << " pv";
+                for (const auto& move : info.pv) out << " " << ChessUtility::moveToString(move);
+            }
+        }
+
+        m_writer.writeLine(out.str());
+    }
+}
\ No newline at end of file
@@ -83,6 +83,19 @@ namespace owl
          * Funktionalitt fr das Frontend der SchwachMatt-Engine
          */
         VOID handleGetValidMovesCommand(Command& cmd);
+        /**
+         * Den Befehl fr die Bitbasen verarbeiten: KPK, KRK und KQK neu erzeugen und speichern.
+         */
+        VOID handleBitbasesCommand(Command& cmd);
+        /**
+         * Den Befehl "bench [depth]" verarbeiten: Feste Stellungen durchsuchen
+         * und die Summe der Knoten (Signatur) sowie Knoten pro Sekunde ausgeben.
+         */
+        VOID handleBenchCommand(Command& cmd);
+        /**
+         * Den Befehl "stats" verarbeiten: Statistik der letzten Suche ausgeben.
+         */
+        VOID handleStatsCommand(Command& cmd);
 
         /**
          * Suchfunktion der UCI.
@@ -90,6 +103,11 @@ namespace owl
          * \return 
          */
         VOID go(std::shared_ptr<GoSubcommandData> p_data);
+        /**
+         * Suchinformationen der Engine als UCI-Befehl "info" ausgeben.
+         * \param info Aktueller Stand der Suche
+         */
+        VOID handleSearchInfo(const SearchInfo& info);
 
     private:
         BOOL m_readyCheckQueued = false; // Flag zur berprfung ob die Engine "ready" ist
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+
+#include "defines.hpp"
+
+namespace owl
+{
+	/**
+	 * Zobrist-Schlssel zur Identifikation einer Stellung (Stellungswiederholung, Hash-Tabellen).
+	 * Die Zufallszahlen werden zur Kompilierzeit mit SplitMix64 erzeugt.
+	 */
+	namespace zobrist
+	{
+		constexpr INT32 SQUARE_COUNT = ROWS * COLUMNS; // Anzahl der Felder
+
+		constexpr INT32 PIECE_KEYS = PLAYER_COUNT * MAX_PIECE_TYPES * SQUARE_COUNT; // Schlssel fr Figur auf Feld
+		constexpr INT32 CASTLING_KEYS = 4; // Schlssel fr die Rochaderechte (WK, WQ, BK, BQ)
+		constexpr INT32 EN_PASSANT_KEYS = COLUMNS; // Schlssel fr die En-Passant-Spalte
+		constexpr INT32 SIDE_KEYS = 1; // Schlssel fr Schwarz am Zug
+
+		constexpr INT32 CASTLING_OFFSET = PIECE_KEYS;
+		constexpr INT32 EN_PASSANT_OFFSET = CASTLING_OFFSET + CASTLING_KEYS;
+		constexpr INT32 SIDE_OFFSET = EN_PASSANT_OFFSET + EN_PASSANT_KEYS;
+		constexpr INT32 KEY_COUNT = SIDE_OFFSET + SIDE_KEYS;
+
+		constexpr INT32 WHITE_CASTLING_SHORT = 0;
+		constexpr INT32 WHITE_CASTLING_LONG = 1;
+		constexpr INT32 BLACK_CASTLING_SHORT = 2;
+		constexpr INT32 BLACK_CASTLING_LONG = 3;
+
+		/**
+		 * Erzeuge alle Zufallszahlen mit SplitMix64.
+		 *
+		 * \param seed Startwert
+		 * \return Zufallszahlen
+		 */
+		constexpr std::array<UINT64, KEY_COUNT> GENERATE_KEYS(UINT64 seed)
+		{
+			std::array<UINT64, KEY_COUNT> keys = {};
+			for (auto i = 0; i < KEY_COUNT; i++)
+			{
+				seed += 0x9E3779B97F4A7C15ULL;
+				UINT64 z = seed;
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+				keys[i] = z ^ (z >> 31);
+			}
+			return keys;
+		}
+
+		constexpr std::array<UINT64, KEY_COUNT> KEYS = GENERATE_KEYS(0x4F574C2D4D415454ULL); // Alle Zobrist-Schlssel
+
+		/**
+		 * Schlssel einer Figur auf einem Feld.
+		 *
+		 * \param piece Figur (kein leeres Feld)
+		 * \param x Spalte
+		 * \param y Reihe
+		 * \return Schlssel
+		 */
+		constexpr UINT64 PIECE(CHAR piece, INT32 x, INT32 y)
+		{
+			return KEYS[(GET_PLAYER_INDEX_BY_PIECE(piece) * MAX_PIECE_TYPES + GET_PIECE_INDEX_BY_TYPE(piece)) * SQUARE_COUNT + y * COLUMNS + x];
+		}
+
+		/**
+		 * Schlssel eines Rochaderechts.
+		 *
+		 * \param index Rochaderecht (WHITE_CASTLING_SHORT, ...)
+		 * \return Schlssel
+		 */
+		constexpr UINT64 CASTLING(INT32 index)
+		{
+			return KEYS[CASTLING_OFFSET + index];
+		}
+
+		/**
+		 * Schlssel der En-Passant-Spalte.
+		 *
+		 * \param x Spalte
+		 * \return Schlssel
+		 */
+		constexpr UINT64 EN_PASSANT(INT32 x)
+		{
+			return KEYS[EN_PASSANT_OFFSET + x];
+		}
+
+		constexpr UINT64 SIDE = KEYS[SIDE_OFFSET]; // Schlssel fr Schwarz am Zug
+	}
+}
@@ -6,8 +6,6 @@
 #include <cstdint>
 
 #define OWL_USE_RANDOM false
-#define OWL_USE_EVALUATION_COMPONENT_REPRESENTAION true
-#define OWL_LOG_MOVE_STACK false
 #define OWL_LOG_NO_INFO true
 
 namespace owl
@@ -25,8 +23,10 @@ namespace owl
 	class CommandBuilder;
 	class EngineOptions;
 	class MinMaxResult;
+	class OutputWriter;
 
 	struct Move;
+	struct SearchInfo;
 
 	// Typdefinitionen
 	typedef std::int16_t INT16;
@@ -76,14 +76,19 @@ namespace owl
 	constexpr UCHAR FT_STANDARD = FT_ALPHA_BETA | FT_SRT_MATERIAL | FT_SRT_MVV_LVA | FT_SRT_KILLER; // OWL-Matt Standard Features
 
 	constexpr FLOAT RANDOM_DELTA_PHI_CUT = 0.510385f; // Delta-Phi-Cut
-	constexpr FLOAT RANDOM_THRESHOLD = OWL_USE_RANDOM==false ? 0 : RANDOM_DELTA_PHI_CUT; // Standardabweichung fr alle Zge mit relativen Abstand zum besten gefunden Zug (Delta-Phi-Cut)
+	constexpr INT32 RANDOM_THRESHOLD = OWL_USE_RANDOM==false ? 0 : static_cast<INT32>(RANDOM_DELTA_PHI_CUT * 100); // Standardabweichung (in Centipawns) fr alle Zge mit relativen Abstand zum besten gefunden Zug (Delta-Phi-Cut)
 	constexpr INT32 MAX_RANDOM_MOVES_SIZE = 7; // Maximale Anzahl der erlaubten Zufallszge
 	// Spieler
 	constexpr INT32 PLAYER_WHITE = 1;	// Spieler Wei
 	constexpr INT32 PLAYER_BLACK = -1;	// Spieler Schwarz
 
-	// Maximalwert fr Endstellung
-	constexpr FLOAT INF = 999.0f; // Maximaler Bewertungswert (Fr Endstellungen)
+	// Bewertungen der Suche in Centipawns (Hundertstel eines Bauern)
+	using EVALUATION_VALUE = INT32; // Alias fr Evaluierungswert
+	constexpr FLOAT CENTIPAWNS_PER_PAWN = 100.0f; // Umrechnung der Bewertungskomponenten (Bauerneinheiten) in Centipawns
+
+	constexpr EVALUATION_VALUE INF = 32000; // Maximaler Bewertungswert (Suchfenster), grer als jede Mattbewertung
+	constexpr EVALUATION_VALUE MATE_VALUE = 30000; // Bewertung einer Mattstellung; je Halbzug Abstand zur Wurzel wird 1 abgezogen
+	constexpr EVALUATION_VALUE DRAW_VALUE = 0; // Bewertung einer Remis-Stellung (Stellungswiederholung, 50-Zge-Regel)
 
 	// Parameter-Konstanten
 	constexpr INT32 KILLER_SIZE		= 2; // Anzahl der mglichen Killerzge bezogenen auf eine Tiefe im Suchbaum
@@ -96,6 +101,48 @@ namespace owl
 	constexpr INT32 KILLER_EMPTY	= -1;	// Noch keine Killer vorhanden?
 
 	constexpr INT32 MAX_DEPTH = 4; // Spter auf maximale erreichbare Suchtiefe anpassen
+	constexpr INT32 MAX_SEARCH_DEPTH = 64; // Maximale Suchtiefe der iterativen Vertiefung (z.B. fr "go infinite")
+
+	constexpr EVALUATION_VALUE MATE_BOUND = MATE_VALUE - MAX_SEARCH_DEPTH; // Ab diesem Betrag ist eine Bewertung ein Matt
+
+	/**
+	 * Ist die Bewertung ein (erzwungenes) Matt?
+	 *
+	 * \param value Bewertung
+	 * \return true, wenn eine der Seiten mattsetzt
+	 */
+	constexpr BOOL IS_MATE_SCORE(EVALUATION_VALUE value)
+	{
+		return value >= MATE_BOUND || value <= -MATE_BOUND;
+	}
+
+	/**
+	 * Mattbewertung um den Abstand zur Wurzel verringern, damit krzere Matts bevorzugt werden.
+	 *
+	 * \param value Bewertung der Endstellung (+/-MATE_VALUE) oder eine andere Bewertung
+	 * \param ply Halbzug ab der Wurzel
+	 * \return Angepasste Bewertung
+	 */
+	constexpr EVALUATION_VALUE MATE_SCORE_AT_PLY(EVALUATION_VALUE value, INT32 ply)
+	{
+		return value >= MATE_BOUND ? value - ply : value <= -MATE_BOUND ? value + ply : value;
+	}
+
+	/**
+	 * Anzahl der Zge bis zum Matt (z.B. fr UCI "score mate").
+	 *
+	 * \param value Mattbewertung (siehe IS_MATE_SCORE())
+	 * \return Zge bis Matt, negativ falls der Spieler selbst mattgesetzt wird
+	 */
+	constexpr INT32 MATE_IN_MOVES(EVALUATION_VALUE value)
+	{
+		return value > 0 ? (MATE_VALUE - value + 1) / 2 : -(MATE_VALUE + value + 1) / 2;
+	}
+
+	// Analyse-Ausgabe (UCI "info")
+	constexpr INT64 CURRMOVE_REPORT_DELAY = 1000; // Ab welcher Suchzeit in ms "info currmove" gesendet wird
+	constexpr INT64 SEARCH_POLL_INTERVAL = 128; // Knotenintervall (Zweierpotenz) fr die berprfung von Zeit- und Knotengrenzen
+	constexpr INT64 CURRMOVE_REPORT_INTERVAL = 250; // Mindestabstand in ms zwischen zwei "info currmove"-Ausgaben
 
 	// Positionsbezogen:
 	constexpr INT32 EN_PASSANT_WHITE_Y = 5; // bergangene Zeile y bei En Passant fr Spieler Wei
@@ -134,7 +181,9 @@ namespace owl
 	using MOVE_LIST = std::vector<Move>; // Liste an Zgen
 	//using KILLER_LIST = Move[KILLER_SIZE][MAX_DEPTH]; // Killer-Liste fr Killer-Heuristik
 
-	using KILLER_LIST = std::array<std::array<Move, MAX_DEPTH>, KILLER_SIZE>; // Killerzug-Liste
+	using KILLER_LIST = std::array<std::array<Move, MAX_SEARCH_DEPTH>, KILLER_SIZE>; // Killerzug-Liste (Index: Halbzug ab der Wurzel)
+	using PV_TABLE = std::array<std::array<Move, MAX_SEARCH_DEPTH + 1>, MAX_SEARCH_DEPTH + 1>; // Triangulare Tabelle der Hauptvarianten (Index: Halbzug ab der Wurzel)
+	using PV_LENGTH_LIST = std::array<INT32, MAX_SEARCH_DEPTH + 1>; // Lngen der Hauptvarianten je Halbzug ab der Wurzel
 
 	template <class A,class B>
 	using PAIR = std::pair<A, B>; // Paar
@@ -143,6 +192,10 @@ namespace owl
 	constexpr BOOL CHOOSE_LEFT = true;		// Sich bei std::sort fr das linke Element entscheiden
 	constexpr BOOL CHOOSE_RIGHT = false;	// Sich bei std::sort fr das rechte Element entscheiden
 
+	constexpr INT32 ORDER_GOOD_CAPTURE = 0;	// Schlagzug mit SEE >= 0 (vor Killern und ruhigen Zgen)
+	constexpr INT32 ORDER_QUIET = 1;		// Ruhiger Zug (Killer- und Material-Heuristik)
+	constexpr INT32 ORDER_BAD_CAPTURE = 2;	// Schlagzug mit SEE < 0 (nach Killern und ruhigen Zgen)
+
 	// Notwendige Konstanten
 	constexpr INT32 WHITE_INDEX = 0; // Index fr Spieler Wei
 	constexpr INT32 BLACK_INDEX = 1; // Index fr Spieler Schwar
@@ -187,15 +240,33 @@ namespace owl
         | EVAL_FT_DYNAMIC_PAWNS
         ;
 
+	// Keine Bewertungsfunktions-Features (nur Material, z.B. fr die Zugsortierung)
+	constexpr UCHAR EVAL_FT_NULL = 0;
+
 	// Alle Bewertungsfunktions-Features
 	constexpr UCHAR EVAL_FT_ALL = 0xff;
 
-	// Datentyp fr Evaluierung anpassen
-	// Zur berwachung des Einflusses der Bewertungskomponenten wird das Datenobjekt einfach angepasst
-	// Damit im Code nichts verndert wewrden muss, werden auch alle grundlegenden boolischen Vergleichsoperationen berladen
-#if OWL_USE_EVALUATION_COMPONENT_REPRESENTAION==true
+	// Feature-Parameter als Template-Parameter (ChessEngine::minMax(), ChessEvaluation::evaluate()):
+	// Hufige Kombinationen (FT_STANDARD, EVAL_FT_STANDARD) werden explizit instanziiert, alle anderen ber FT_RUNTIME
+	constexpr INT32 FT_RUNTIME = -1; // Feature-Parameter erst zur Laufzeit auswerten (z.B. fr Ablationsstudien)
+
+	/**
+	 * Wirksame Feature-Parameter einer Template-Instanz. Fr feste Flags ist das Ergebnis eine Konstante,
+	 * sodass der Compiler die Abfragen der Features entfernt.
+	 *
+	 * \param flags Feature-Parameter zur Laufzeit (nur fr FT_RUNTIME verwendet)
+	 * \return Feature-Parameter
+	 */
+	template <INT32 Flags>
+	constexpr UCHAR FEATURE_FLAGS(UCHAR flags)
+	{
+		return Flags == FT_RUNTIME ? flags : static_cast<UCHAR>(Flags);
+	}
+
+	// Zur berwachung des Einflusses der Bewertungskomponenten (z.B. UCI-Befehl "eval") liefert
+	// ChessEvaluation::trace() die Aufschlsselung in Bauerneinheiten. Die Suche verwendet nur EVALUATION_VALUE.
 	/**
-	 * Datenstruktur des Evaluierungswerts (Speichert die Werte zu jeder Bewertungskomponente mit)
+	 * Aufschlsselung einer Bewertung in ihre Komponenten (in Bauerneinheiten)
 	 */
 	struct EvaluationDataScore
 	{
@@ -311,10 +382,8 @@ namespace owl
         }
 	};
 
-	using EVALUATION_VALUE = EvaluationDataScore; // Alias fr Evaluierungswert auf Datenstruktur setzen
-
-	// Print-Funktion fr Evaluierungswert
-	inline VOID PRINT_EVALUATION_VALUE(const EVALUATION_VALUE& data)
+	// Print-Funktion fr die Aufschlsselung einer Bewertung
+	inline VOID PRINT_EVALUATION_VALUE(const EvaluationDataScore& data)
 	{
 		std::cout << "{";
 		std::cout << " score: " << data.score;
@@ -327,17 +396,6 @@ namespace owl
 		std::cout << " + dynamicpawns: " << data.dynamicPawns;
 		std::cout << " }\n";
 	}
-#else
-	using EVALUATION_VALUE = FLOAT; // Alias fr Evaluierungswert auf FLOAT setzen
-
-	// Print-Funktion fr Evaluierungswert
-	inline VOID PRINT_EVALUATION_VALUE(const EVALUATION_VALUE data)
-	{
-		std::cout << "{";
-		std::cout << " score: " << data;
-		std::cout << " }\n";
-	}
-#endif
 	// Faktoren (Mit welcher Gewichtung die Features Einfluss auf die Bewertung haben 0.0 = 0% und 1.0 = 100%)
 	constexpr FLOAT MATERIAL_DYNAMIC_GAME_PHASE_WEIGHT	= 1.00f; // Materialwerte zu Spielphase (Faktor)
 	constexpr FLOAT PIECE_SQUARE_TABLE_WEIGHT			= 0.50f; // Piece-Square-Tabelle (Faktor)
@@ -347,30 +405,32 @@ namespace owl
 
 	// Materialwert + Addition fr die jeweilige Spielphase								//  P	   N	  B		 R		Q		K
 	constexpr std::array<FLOAT, MAX_PIECE_TYPES> MATERIAL_VALUES						= { 1.00f, 3.00f, 3.00f, 5.00f, 9.00f,	0.00f }; // Materialwert
-	constexpr std::array<FLOAT, MAX_PIECE_TYPES> MATERIAL_ADDITION_BEGIN_GAME_PHASE		= { 0.00f, 0.25f, 0.25f, 0.00f, 0.00f,	0.00f }; // Materialwert-Addition in der Erffnung
-	constexpr std::array<FLOAT, MAX_PIECE_TYPES> MATERIAL_ADDITION_MID_GAME_PHASE		= { 0.00f, 0.50f, 0.50f, 0.50f, 0.50f,	0.00f }; // Materialwert-Addition im Mittelspiel
+	constexpr std::array<EVALUATION_VALUE, MAX_PIECE_TYPES> SEE_VALUES				= { 100,   300,   300,   500,   900,	10000 }; // Figurenwerte in Centipawns fr die Static Exchange Evaluation (Knig: praktisch unschlagbar)
+	constexpr INT32 MAX_EXCHANGE_SEQUENCE = 32; // Maximale Lnge einer Schlagabfolge auf einem Feld (Static Exchange Evaluation)
+	constexpr std::array<FLOAT, MAX_PIECE_TYPES> MATERIAL_ADDITION_BEGIN_GAME_PHASE		= { 0.00f, 0.25f, 0.25f, 0.00f, 0.00f,	0.00f }; // Materialwert-Addition in der Erffnung (volles Material)
 	constexpr std::array<FLOAT, MAX_PIECE_TYPES> MATERIAL_ADDITION_END_GAME_PHASE		= { 0.00f, 0.50f, 0.50f, 0.75f, 0.75f,	0.00f }; // Materialwert-Addition im Endspiel
 
 	// Spielphase Material Balance
 	constexpr std::array<INT32, MAX_PIECE_TYPES> START_PIECE_COUNT = { 8,	   2,	  2,	 2,		1,		1 }; // Anzahl der Figuren beim Start (Fr 100% Materialwertberechnung)
 
-	// Berechne die Maximale Summe
-	constexpr FLOAT GET_MAX_MATERIAL_SUM(FLOAT ratio) {
+	// Berechne die Maximale Summe des Materials ohne Bauern
+	constexpr FLOAT GET_MAX_NON_PAWN_MATERIAL_SUM(FLOAT ratio) {
 		auto value = 0.0f;
 		for (auto type_index = 0; type_index < MAX_PIECE_TYPES; type_index++)
 		{
-			value += MATERIAL_VALUES[type_index] * START_PIECE_COUNT[type_index];
+			if (type_index != PAWN_INDEX) value += MATERIAL_VALUES[type_index] * START_PIECE_COUNT[type_index];
 		}
 		return ratio * PLAYER_COUNT * value;
 	};
 
 	constexpr FLOAT MATERIAL_RATIO_FULL = 1.00f;		// Anfangsmaterialfaktor
-	constexpr FLOAT MATERIAL_RATIO_MID_GAME = 0.85f;	// Mittelspielmaterialfaktor
-	constexpr FLOAT MATERIAL_RATIO_END_GAME = 0.50f;	// Endspielmaterialfaktor
+	constexpr FLOAT MATERIAL_RATIO_END_GAME = 0.25f;	// Endspielmaterialfaktor (Material ohne Bauern)
 
-	constexpr FLOAT MAX_MATERIAL_SUM = GET_MAX_MATERIAL_SUM(MATERIAL_RATIO_FULL);				// Erffnungs-Material-Summe
-	constexpr FLOAT MAX_MATERIAL_SUM_MID_GAME = GET_MAX_MATERIAL_SUM(MATERIAL_RATIO_MID_GAME);	// Mittelspiel-Material-Summe
-	constexpr FLOAT MAX_MATERIAL_SUM_END_GAME = GET_MAX_MATERIAL_SUM(MATERIAL_RATIO_END_GAME);	// Endspiel-Material-Summe
+	// Die Spielphase wird aus dem Material ohne Bauern linear zwischen Endspiel (0.0) und vollem Material (1.0) bestimmt
+	constexpr FLOAT MAX_NON_PAWN_MATERIAL_SUM = GET_MAX_NON_PAWN_MATERIAL_SUM(MATERIAL_RATIO_FULL);			// Erffnungs-Material-Summe ohne Bauern
+	constexpr FLOAT MAX_NON_PAWN_MATERIAL_SUM_END_GAME = GET_MAX_NON_PAWN_MATERIAL_SUM(MATERIAL_RATIO_END_GAME);	// Endspiel-Material-Summe ohne Bauern
+	constexpr FLOAT PHASE_MID_GAME = 1.0f; // Spielphase bei vollem Material
+	constexpr FLOAT PHASE_END_GAME = 0.0f; // Spielphase im Endspiel
 
 	// Weie Figuren:
 	constexpr CHAR WHITE_PAWN = 'P';
@@ -495,10 +555,17 @@ namespace owl
 	// Figurenbewegung (Gewichtung)
 	constexpr FLOAT PIECE_MOBILITY_PAWN_WEIGHT		= 0.10f; // Bauern-Figurbewegung (Faktor)
 	constexpr FLOAT PIECE_MOBILITY_KNIGHT_WEIGHT	= 0.10f; // Springer-Figurenbewegung (Faktor)
-	constexpr FLOAT PIECE_MOBILITY_BISHOP_WEIGHT	= 0.10f; // Lufer-Figurenbewegung (Faktor)
-	constexpr FLOAT PIECE_MOBILITY_ROOK_WEIGHT		= 0.10f; // Turm-Figurenbewegung (Faktor)
-	constexpr FLOAT PIECE_MOBILITY_QUEEN_WEIGHT		= 0.10f; // Dame-Figurenbewegung (Faktor)
+	// Lufer, Turm und Dame gingen bisher nicht in die Bewertung ein. Ihre Gewichte sind nicht abgestimmt und bleiben daher 0
+	constexpr FLOAT PIECE_MOBILITY_BISHOP_WEIGHT	= 0.00f; // Lufer-Figurenbewegung (Faktor)
+	constexpr FLOAT PIECE_MOBILITY_ROOK_WEIGHT		= 0.00f; // Turm-Figurenbewegung (Faktor)
+	constexpr FLOAT PIECE_MOBILITY_QUEEN_WEIGHT		= 0.00f; // Dame-Figurenbewegung (Faktor)
 	constexpr FLOAT PIECE_MOBILITY_KING_WEIGHT		= 0.10f; // Knig-Figurenbewegung (Faktor)
+	constexpr BOOL PIECE_MOBILITY_EXCLUDE_PAWN_ATTACKS = false; // Von gegnerischen Bauern angegriffene Felder nicht zhlen (Springer, Lufer, Turm, Dame)
+
+	// Figurenbewegung je Figurentyp															//  P	   N	  B		 R		Q		K
+	constexpr std::array<FLOAT, MAX_PIECE_TYPES> PIECE_MOBILITY_TYPE_WEIGHTS	= { PIECE_MOBILITY_PAWN_WEIGHT, PIECE_MOBILITY_KNIGHT_WEIGHT, PIECE_MOBILITY_BISHOP_WEIGHT,
+		PIECE_MOBILITY_ROOK_WEIGHT, PIECE_MOBILITY_QUEEN_WEIGHT, PIECE_MOBILITY_KING_WEIGHT }; // Gewichtung (Faktor)
+	constexpr std::array<INT32, MAX_PIECE_TYPES> PIECE_MOBILITY_MAX			= { 4,	   8,	  13,	 14,	27,		8 }; // Hchstens gezhlte Felder je Figur (Schranke fr die Lazy Evaluation)
 
 	// Zustzliche Dynamische Bauerngewichtung
 	constexpr INT32 MAX_DYNAMIC_PAWNS = MAX_PAWN_COUNT; // Anzahl der mglichen Bauern fr die Dynamik
@@ -519,6 +586,16 @@ namespace owl
 	constexpr FLOAT PAWN_STRUCTURE_CHAIN_PAWNS_BONUS = 0.100f;	// Bauernkette Bonus
 	constexpr FLOAT PAWN_STRUCTURE_PASSED_PAWNS_BONUS = 0.300f;	// Freibauern Bonus
 	constexpr FLOAT PAWN_STRUCTURE_CONNECTED_PASSED_PAWNS_BONUS = 0.700f; // Freibauern, die verbunden sind
+
+	// Schranken der Bauernstruktur je Bauer fr die Lazy Evaluation: Alle Boni bzw. alle Mali treffen gleichzeitig zu
+	constexpr FLOAT PAWN_STRUCTURE_MAX_BONUS = [] {
+		auto progress = 0.0f;
+		for (auto bonus : PASSED_PAWNS_PROGRESS_BONUS) progress = bonus > progress ? bonus : progress;
+		return (PAWN_STRUCTURE_CONNECTED_PAWNS_BONUS + PAWN_STRUCTURE_CHAIN_PAWNS_BONUS + PAWN_STRUCTURE_PASSED_PAWNS_BONUS
+			+ PAWN_STRUCTURE_CONNECTED_PASSED_PAWNS_BONUS + progress) * PAWN_STRUCTURE_WEIGHT;
+	}();
+	constexpr FLOAT PAWN_STRUCTURE_MAX_PENALTY = -(PAWN_STRUCTURE_DOUBLE_PAWNS_PENALTY + PAWN_STRUCTURE_ISOLATED_PAWNS_PENALTY
+		+ PAWN_STRUCTURE_BACKWARDS_PAWNS_PENALTY + PAWN_STRUCTURE_ISOLATED_DOUBLE_PAWNS_PENALTY) * PAWN_STRUCTURE_WEIGHT;
 	// Piece Square Tables
 	constexpr FLOAT PIECE_SQUARE_TABLE_PAWN_WEIGHT = 1.0f;	// Bauern-Tabellen-Gewicht (Faktor)
 	constexpr FLOAT PIECE_SQUARE_TABLE_KNIGHT_WEIGHT = 1.0f;	// Springer-Tabellen-Gewicht (Faktor)
@@ -612,50 +689,6 @@ namespace owl
 		-0.50f,-0.30f,-0.30f,-0.30f,-0.30f,-0.30f,-0.30f,-0.50f
 	};
 
-	// Funktion zur Spiegelung der Piece-Square-Tables (Fr Spieler Schwarz)
-	constexpr std::array<FLOAT, MAX_FIELDS_ON_BOARD> MIRROR_PIECE_SQUARE_TABLE(const std::array<FLOAT, MAX_FIELDS_ON_BOARD> t)
-	{
-		std::array<FLOAT, MAX_FIELDS_ON_BOARD>&& sort_table =
-		{
-			t[56], t[57], t[58], t[59], t[60], t[61], t[62], t[63],
-			t[48], t[49], t[50], t[51], t[52], t[53], t[54], t[55],
-			t[40], t[41], t[42], t[43], t[44], t[45], t[46], t[47],
-			t[32], t[33], t[34], t[35], t[36], t[37], t[38], t[39],
-			t[24], t[25], t[26], t[27], t[28], t[29], t[30], t[31],
-			t[16], t[17], t[18], t[19], t[20], t[21], t[22], t[23],
-			 t[8],  t[9], t[10], t[11], t[12], t[13], t[14], t[15],
-			 t[0],  t[1],  t[2],  t[3],  t[4],  t[5],  t[6],  t[7]
-		};
-
-		return sort_table;
-	}
-
-	/**
-	 * Mgliche Caputres in Schach.
-	 */
-	enum class Captures
-	{
-		kxP, kxN, kxB, kxR, kxQ,
-		qxP, qxN, qxB, qxR, qxQ,
-		rxP, rxN, rxB, rxR, rxQ,
-		bxP, bxN, bxB, bxR, bxQ,
-		nxP, nxN, nxB, nxR, nxQ,
-		pxP, pxN, pxB, pxR, pxQ
-	};
-
-	/**
-	 * String zu den mglichen Captures in Schach. (Fr Logging)
-	 */
-	static constexpr std::array<CHAR*, MAX_PIECE_TYPES* (MAX_PIECE_TYPES - 1)> s_capture_map =
-	{
-		"kxP","kxN","kxB","kxR","kxQ",
-		"qxP","qxN","qxB","qxR","qxQ",
-		"rxP","rxN","rxB","rxR","rxQ",
-		"bxP","bxN","bxB","bxR","bxQ",
-		"nxP","nxN","nxB","nxR","nxQ",
-		"pxP","pxN","pxB","pxR","pxQ"
-	};
-
 	// Maximale Zge
 	constexpr INT32 MAX_MOVES_PER_PLY_BOUND = 64; // Maximal legale Zge pro Zug (Wird fr Speicherallokation eines std::vector verwendet)
 	constexpr INT32 MAX_MOVES_PER_KNIGHT = 8; // Maximale Anzahl der Zge fr einen Springer
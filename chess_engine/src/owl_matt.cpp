@@ -2,10 +2,23 @@
 
 #include "defines.hpp"
 
+#include <string>
+
 #include "UniversalChessInterface.hpp"
 
-auto main() -> owl::INT32
+auto main(owl::INT32 argc, owl::CHAR* argv[]) -> owl::INT32
 {
 	owl::UniversalChessInterface uci;
+
+	// Kommandozeile: "owl_matt bench [depth]" fhrt nur den Benchmark aus
+	if (argc > 1 && std::string(argv[1]) == "bench")
+	{
+		std::string command = argv[1];
+		for (auto i = 2; i < argc; i++) command += std::string(" ") + argv[i];
+
+		uci.resolveCommand(command);
+		return 0;
+	}
+
 	uci.start();
 }
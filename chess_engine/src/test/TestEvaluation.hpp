@@ -223,11 +223,11 @@ namespace owl
 			inline static void deltaPhiCut()
 			{
 				Position pos = ChessUtility::fenToPosition(STARTPOS_FEN);
-				std::vector<EVALUATION_VALUE> owl_phi_k;
+				std::vector<EvaluationDataScore> owl_phi_k;
 				size_t sf_count = 39;
 				//size_t sf_count = sizeof(RESULT_STOCKFISH_PHI_K) / sizeof(double);
 
-				owl_phi_k.push_back(ChessEvaluation::evaluate(pos, PLAYER_WHITE, EVAL_FT_STANDARD, true));
+				owl_phi_k.push_back(ChessEvaluation::trace(pos, PLAYER_WHITE, EVAL_FT_STANDARD));
 
 				double delta_phi_k = 0;
 				double varianz = 0;
@@ -247,7 +247,7 @@ namespace owl
 
 					if (fen_f != fen_t) std::cout << fen_f << " != " << fen_t << std::endl;
 
-					owl_phi_k.push_back(ChessEvaluation::evaluate(pos, PLAYER_WHITE, EVAL_FT_STANDARD, true));
+					owl_phi_k.push_back(ChessEvaluation::trace(pos, PLAYER_WHITE, EVAL_FT_STANDARD));
 				}
 
 				double errors = 0.0;
@@ -20,6 +20,73 @@ project "chess_engine"
       "external/spdlog",
    }
 
+   filter "configurations:Debug"
+      defines { "DEBUG" }
+      symbols "On"
+
+   filter "configurations:Release"
+      defines { "NDEBUG" }
+      optimize "On"
+   
+   filter { "platforms:Win64 "}
+      system "Windows"
+      architecture "x86_64"
+
+project "micro_benchmark"
+   location "chess_engine"
+   kind "ConsoleApp"
+   language "C++"
+   cppdialect "C++17"
+   targetdir "bin/%{cfg.buildcfg}"
+   objdir "bin-int/%{cfg.buildcfg}/micro_benchmark"
+
+   files { 
+      "chess_engine/src/**.hpp",
+      "chess_engine/src/**.cpp",
+      "chess_engine/benchmark/MicroBenchmark.hpp",
+      "chess_engine/benchmark/micro_benchmark.cpp",
+   }
+
+   -- the engine's entry point is replaced by the benchmark's
+   removefiles { "chess_engine/src/owl_matt.cpp" }
+
+   includedirs {
+      "external/spdlog",
+   }
+
+   filter "configurations:Debug"
+      defines { "DEBUG" }
+      symbols "On"
+
+   filter "configurations:Release"
+      defines { "NDEBUG" }
+      optimize "On"
+   
+   filter { "platforms:Win64 "}
+      system "Windows"
+      architecture "x86_64"
+
+project "ablation_benchmark"
+   location "chess_engine"
+   kind "ConsoleApp"
+   language "C++"
+   cppdialect "C++17"
+   targetdir "bin/%{cfg.buildcfg}"
+   objdir "bin-int/%{cfg.buildcfg}/ablation_benchmark"
+
+   files { 
+      "chess_engine/src/**.hpp",
+      "chess_engine/src/**.cpp",
+      "chess_engine/benchmark/ablation_benchmark.cpp",
+   }
+
+   -- the engine's entry point is replaced by the benchmark's
+   removefiles { "chess_engine/src/owl_matt.cpp" }
+
+   includedirs {
+      "external/spdlog",
+   }
+
    filter "configurations:Debug"
       defines { "DEBUG" }
       symbols "On"